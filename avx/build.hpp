@@ -0,0 +1,6 @@
+#define VERSION "2.2.0"
+#define IDENTIFIER "a83adf8be96da2ed8c21ded03123b55ee03c8c62"
+#define SHORTID "a83adf8"
+#define COMPILER "g++ (Debian 12.2.0-14+deb12u1) 12.2.0"
+#define FLAGS "-O3 -DNDEBUG -march=native -Wall -Wextra -Wall -Wextra -O3 -DNDEBUG"
+#define DATE "Fri Oct 16 22:00:33 UTC 2026 Linux vm 6.18.44-fc-v139 x86_64"
@@ -0,0 +1,6 @@
+#define VERSION "2.2.0"
+#define IDENTIFIER "cf7f573cd1995740639f025e0a004500f7f0bd56"
+#define SHORTID "cf7f573"
+#define COMPILER "g++ (Debian 12.2.0-14+deb12u1) 12.2.0"
+#define FLAGS "-Wall -Wextra -O3 -DNDEBUG -pthread"
+#define DATE "Fri Oct 16 23:48:35 UTC 2026 Linux vm 6.18.44-fc-v139 x86_64"
@@ -0,0 +1,7 @@
+extern "C" {
+#include <unistd.h>
+};
+int main () {
+  closefrom (0);
+  return 0;
+}
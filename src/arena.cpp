@@ -2,29 +2,42 @@
 
 namespace CaDiCaL {
 
-Arena::Arena (Internal *i) {
-  memset (this, 0, sizeof *this);
-  internal = i;
+Arena::Arena (Internal *i) : internal (i) {
+  memset (&to, 0, sizeof to);
 }
 
 Arena::~Arena () {
-  delete[] from.start;
-  delete[] to.start;
+  for (const auto &space : from)
+    deallocate_memory (space.start);
+  deallocate_memory (to.start);
 }
 
 void Arena::prepare (size_t bytes) {
   LOG ("preparing 'to' space of arena with %zd bytes", bytes);
   assert (!to.start);
-  to.top = to.start = new char[bytes];
+  const bool huge_pages = internal->opts.hugepages;
+  to.top = to.start = allocate_memory (bytes, huge_pages, to.advised);
   to.end = to.start + bytes;
 }
 
 void Arena::swap () {
-  delete[] from.start;
-  LOG ("delete 'from' space of arena with %zd bytes",
-       (size_t) (from.end - from.start));
-  from = to;
-  to.start = to.top = to.end = 0;
+  const auto end = from.end ();
+  auto j = from.begin (), i = j;
+  while (i != end) {
+    const Space &space = *j++ = *i++;
+    if (!space.evacuate)
+      continue;
+    deallocate_memory (space.start);
+    LOG ("delete 'from' region of arena with %zd bytes",
+         (size_t) (space.end - space.start));
+    j--;
+  }
+  from.resize (j - from.begin ());
+  if (to.top == to.start)
+    deallocate_memory (to.start);
+  else
+    from.push_back (to);
+  memset (&to, 0, sizeof to);
 }
 
 } // namespace CaDiCaL
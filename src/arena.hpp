@@ -1,8 +1,12 @@
 #ifndef _arena_hpp_INCLUDED
 #define _arena_hpp_INCLUDED
 
+#include <vector>
+
 namespace CaDiCaL {
 
+using namespace std;
+
 // This memory allocation arena provides fixed size pre-allocated memory for
 // the moving garbage collector 'copy_non_garbage_clauses' in 'collect.cpp'
 // to hold clauses which should survive garbage collection.
@@ -51,15 +55,30 @@ namespace CaDiCaL {
 //
 // One has to be really careful with 'qi' references to arena memory.
 
+// Copying all surviving clauses in one go briefly needs memory for both
+// spaces and the pause grows with the number of clauses.  For incremental
+// use with latency constraints 'opts.arenaslice' bounds the amount of
+// bytes moved in one garbage collection.  Then the 'from' space consists
+// of several regions, each the 'to' space of a previous collection, and
+// only some of them are marked to be evacuated with 'evacuate'.  Clauses
+// in the other regions are kept in place (see 'keeps') and 'swap' only
+// deletes the evacuated regions before adding 'to' as new region.  Without
+// that option all regions are evacuated and there is only one region.
+
 struct Internal;
 
 class Arena {
 
   Internal *internal;
 
-  struct {
+  struct Space {
     char *start, *top, *end;
-  } from, to;
+    size_t advised; // bytes advised to be backed by huge pages
+    bool evacuate;  // delete this region in next 'swap'
+  };
+
+  vector<Space> from; // regions (oldest first)
+  Space to;
 
 public:
   Arena (Internal *);
@@ -76,8 +95,33 @@ public:
   //
   bool contains (void *p) const {
     char *c = (char *) p;
-    return (from.start <= c && c < from.top) ||
-           (to.start <= c && c < to.top);
+    if (to.start <= c && c < to.top)
+      return true;
+    return region (p) >= 0;
+  }
+
+  // Index of the region in 'from' containing 'p' or '-1' if none does.
+  //
+  int region (void *p) const {
+    char *c = (char *) p;
+    for (size_t i = 0; i < from.size (); i++)
+      if (from[i].start <= c && c < from[i].top)
+        return (int) i;
+    return -1;
+  }
+
+  size_t regions () const { return from.size (); }
+
+  // Mark region 'i' to be deleted in the next 'swap', which requires that
+  // all surviving clauses in it are copied to 'to' before.
+  //
+  void evacuate (int i) { from[i].evacuate = true; }
+
+  // Is 'p' in a region which is not evacuated and thus is not moved?
+  //
+  bool keeps (void *p) const {
+    const int i = region (p);
+    return i >= 0 && !from[i].evacuate;
   }
 
   // Allocate that amount of memory in 'to' space.  This assumes the 'to'
@@ -93,11 +137,20 @@ public:
     return res;
   }
 
-  // Completely delete 'from' space and then replace 'from' by 'to' (by
-  // pointer swapping).  Everything previously allocated (in 'from') and not
-  // explicitly copied to 'to' with 'copy' becomes invalid.
+  // Completely delete evacuated regions of 'from' space and then add 'to'
+  // as new region.  Everything previously allocated in evacuated regions
+  // and not explicitly copied to 'to' with 'copy' becomes invalid.
   //
   void swap ();
+
+  // Bytes of the arena advised to be backed by huge pages.
+  //
+  size_t advised () const {
+    size_t res = to.advised;
+    for (const auto &space : from)
+      res += space.advised;
+    return res;
+  }
 };
 
 } // namespace CaDiCaL
@@ -0,0 +1,221 @@
+#include "internal.hpp"
+
+#ifndef NTHREADS
+#include <unordered_set>
+#endif
+
+namespace CaDiCaL {
+
+// Inprocessing ('elim', 'subsume', 'vivify', 'sweep', 'congruence', etc.)
+// stops search while it is running.  With 'opts.background' a snapshot of
+// the root-level units and irredundant clauses is taken at a restart and
+// simplified by a new solver instance in a helper thread while search
+// continues.  The helper solver uses default options and runs 'simplify'
+// with 'opts.backgroundrounds' rounds on the snapshot.
+
+// Only derived units and binary clauses remaining in the simplified
+// formula of the helper and not in the snapshot are returned.  In
+// particular equivalences substituted away by the helper and strengthened
+// larger clauses are lost.  The results are pushed to the thread-safe
+// 'exchange' buffer of this solver and imported at the next restart or
+// whenever search is at the root-level (see 'import.cpp').
+// During import results are validated against the current formula.
+// Clauses over variables eliminated or substituted since the snapshot was
+// taken are skipped as well as root-level satisfied clauses and falsified
+// literals are removed.  All results are implied by the snapshot and thus
+// by the irredundant clauses at the point the snapshot was taken.
+
+// As for imported clauses in general, these clauses can not be justified
+// in proofs and thus nothing is simplified in the background while proofs
+// are traced or clauses are checked.  The helper solver has factoring
+// disabled, since it would introduce variables only known to the helper.
+
+#ifndef NTHREADS
+
+Background::Background (Exchange *e, int r)
+    : exchange (e), rounds (r), stop (false), finished (false), units (0),
+      binaries (0), dropped (0), inconsistent (false) {}
+
+void Background::push (const std::vector<int> &clause) {
+  if (!exchange->push (clause.data (), clause.size ()))
+    dropped++;
+  else if (clause.size () == 1)
+    units++;
+  else
+    binaries++;
+}
+
+static uint64_t binary_key (int a, int b) {
+  if (a > b)
+    std::swap (a, b);
+  return ((uint64_t) (unsigned) a << 32) | (unsigned) b;
+}
+
+struct BackgroundBinaries : public ClauseIterator {
+  std::vector<int> binaries;
+  bool clause (const std::vector<int> &c) {
+    if (c.size () == 2)
+      binaries.push_back (c[0]), binaries.push_back (c[1]);
+    return true;
+  }
+};
+
+void Background::run () {
+  Solver solver;
+  solver.set ("quiet", 1);
+  solver.set ("factor", 0);
+  solver.set ("background", 0);
+  solver.connect_terminator (this);
+
+  // Add the snapshot to the helper solver and remember which units and
+  // binary clauses are already known.
+
+  std::vector<bool> known_units;
+  std::unordered_set<uint64_t> known_binaries;
+  size_t size = 0;
+  for (size_t i = 0; i < snapshot.size (); i++) {
+    const int lit = snapshot[i];
+    solver.add (lit);
+    if (lit) {
+      size++;
+      continue;
+    }
+    if (size == 1) {
+      const int unit = snapshot[i - 1];
+      const size_t idx = abs (unit);
+      if (idx >= known_units.size ())
+        known_units.resize (idx + 1);
+      known_units[idx] = true;
+    } else if (size == 2)
+      known_binaries.insert (binary_key (snapshot[i - 2], snapshot[i - 1]));
+    size = 0;
+  }
+  std::vector<int> ().swap (snapshot);
+
+  const int res = solver.simplify (rounds);
+
+  std::vector<int> clause;
+  if (stop || res == 10)
+    ;
+  else if (res == 20) {
+    inconsistent = true;
+    push (clause);
+  } else {
+    const int max_var = solver.vars ();
+    for (int idx = 1; idx <= max_var; idx++) {
+      if ((size_t) idx < known_units.size () && known_units[idx])
+        continue;
+      const int tmp = solver.fixed (idx);
+      if (!tmp)
+        continue;
+      clause.push_back (tmp < 0 ? -idx : idx);
+      push (clause);
+      clause.clear ();
+    }
+    BackgroundBinaries collector;
+    solver.traverse_clauses (collector);
+    const auto &binaries = collector.binaries;
+    for (size_t i = 0; i < binaries.size (); i += 2) {
+      const int a = binaries[i], b = binaries[i + 1];
+      if (known_binaries.count (binary_key (a, b)))
+        continue;
+      clause.push_back (a);
+      clause.push_back (b);
+      push (clause);
+      clause.clear ();
+    }
+  }
+  solver.disconnect_terminator ();
+  finished = true;
+}
+
+struct BackgroundSnapshot : public ClauseIterator {
+  std::vector<int> &snapshot;
+  BackgroundSnapshot (std::vector<int> &s) : snapshot (s) {}
+  bool clause (const std::vector<int> &c) {
+    for (const auto &lit : c)
+      snapshot.push_back (lit);
+    snapshot.push_back (0);
+    return true;
+  }
+};
+
+#endif
+
+bool Internal::backgrounding () {
+#ifdef NTHREADS
+  return false;
+#else
+  if (!opts.background)
+    return false;
+  if (proof)
+    return false;
+  if (background && !background->finished)
+    return false;
+  return stats.conflicts >= lim.background;
+#endif
+}
+
+void Internal::start_background () {
+#ifdef NTHREADS
+  assert (false);
+#else
+  assert (!background || background->finished);
+  if (background)
+    collect_background ();
+  START (background);
+  stats.background.started++;
+  background = new Background (&exchange, opts.backgroundrounds);
+  vector<int> &snapshot = background->snapshot;
+  for (int eidx = 1; eidx <= external->max_var; eidx++) {
+    const int ilit = external->e2i[eidx];
+    if (!ilit)
+      continue;
+    const int tmp = fixed (ilit);
+    if (!tmp)
+      continue;
+    snapshot.push_back (tmp < 0 ? -eidx : eidx);
+    snapshot.push_back (0);
+  }
+  BackgroundSnapshot collector (snapshot);
+  traverse_clauses (collector);
+  PHASE ("background", stats.background.started,
+         "simplifying snapshot of %zu literals in background",
+         snapshot.size ());
+  background->thread = std::thread (&Background::run, background);
+  lim.background =
+      stats.conflicts + opts.backgroundint * stats.background.started;
+  STOP (background);
+#endif
+}
+
+// Join the helper thread (after asking it to stop if it is still running)
+// and delete it.  Results already pushed to 'exchange' remain there.
+
+void Internal::stop_background () {
+#ifndef NTHREADS
+  if (!background)
+    return;
+  background->stop = true;
+  collect_background ();
+#endif
+}
+
+void Internal::collect_background () {
+#ifndef NTHREADS
+  assert (background);
+  background->thread.join ();
+  stats.background.units += background->units;
+  stats.background.binaries += background->binaries;
+  stats.background.dropped += background->dropped;
+  PHASE ("background", stats.background.started,
+         "background simplification derived %" PRId64 " units and %" PRId64
+         " binary clauses%s",
+         background->units, background->binaries,
+         background->inconsistent ? " (inconsistent)" : "");
+  delete background;
+  background = 0;
+#endif
+}
+
+} // namespace CaDiCaL
@@ -0,0 +1,50 @@
+#ifndef _background_hpp_INCLUDED
+#define _background_hpp_INCLUDED
+
+#ifndef NTHREADS
+
+#include "cadical.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace CaDiCaL {
+
+class Exchange;
+
+// Simplification of a snapshot of the irredundant clauses by a separate
+// solver in a helper thread while search continues (see 'background.cpp').
+// The helper only accesses the snapshot and the thread-safe 'Exchange' of
+// the solver, through which derived units and binary clauses are imported.
+
+struct Background : public Terminator {
+
+  Exchange *exchange; // where results are pushed to
+  int rounds;         // simplification rounds of helper solver
+
+  std::vector<int> snapshot; // units and zero terminated clauses
+
+  std::atomic<bool> stop;     // asked to stop by solver
+  std::atomic<bool> finished; // helper done
+  std::thread thread;
+
+  // Written by the helper thread and only read after joining it.
+  //
+  int64_t units, binaries, dropped;
+  bool inconsistent;
+
+  Background (Exchange *, int rounds);
+
+  bool terminate () { return stop; }
+
+  void push (const std::vector<int> &clause);
+  void run ();
+};
+
+} // namespace CaDiCaL
+
+#endif
+
+#endif
@@ -25,7 +25,7 @@ inline void Internal::unassign (int lit) {
   // variable sits after the variable to which 'queue.unassigned' currently
   // points.  See our SAT'15 paper for more details on this aspect.
   //
-  if (queue.bumped < btab[idx])
+  if (queue.bumped < links[idx].bumped)
     update_queue_unassigned (idx);
 }
 
@@ -76,22 +76,24 @@ void Internal::update_target_and_best () {
 
 /*------------------------------------------------------------------------*/
 
-void Internal::backtrack (int new_level) {
+void Internal::backtrack (int new_level, bool save_trail) {
   assert (new_level <= level);
   if (new_level == level)
     return;
 
   update_target_and_best ();
-  backtrack_without_updating_phases (new_level);
+  backtrack_without_updating_phases (new_level, save_trail);
 }
 
-void Internal::backtrack_without_updating_phases (int new_level) {
+void Internal::backtrack_without_updating_phases (int new_level,
+                                                  bool save_trail) {
 
   assert (new_level <= level);
   if (new_level == level)
     return;
 
   stats.backtracks++;
+  clear_saved_trail ();
 
   assert (num_assigned == trail.size ());
 
@@ -121,6 +123,16 @@ void Internal::backtrack_without_updating_phases (int new_level) {
     int lit = trail[i++];
     Var &v = var (lit);
     if (v.level > new_level) {
+      if (save_trail && v.level < level) {
+        if (v.reason == external_reason) {
+          saved_trail.clear ();
+          saved_reasons.clear ();
+          save_trail = false;
+        } else {
+          saved_trail.push_back (lit);
+          saved_reasons.push_back (v.reason);
+        }
+      }
       unassign (lit);
 #ifdef LOGGING
       unassigned++;
@@ -163,6 +175,13 @@ void Internal::backtrack_without_updating_phases (int new_level) {
     notify_assignments ();
   }
 
+  if (!saved_trail.empty ()) {
+    stats.trailsave.saved += saved_trail.size ();
+    saved_next = saved_trail[0];
+    LOG ("saved %zd literals of trail starting with %d",
+         saved_trail.size (), saved_next);
+  }
+
   control.resize (new_level + 1);
   level = new_level;
   if (tainted_literal) {
@@ -33,6 +33,7 @@ Clause *Eliminator::dequeue () {
 Eliminator::~Eliminator () {
   while (dequeue ())
     ;
+  delete_elim_checkers (checkers);
 }
 
 /*------------------------------------------------------------------------*/
@@ -5,6 +5,15 @@
 #include "internal.hpp"
 #include "signal.hpp" // Separate, only need for apps.
 
+#ifndef NTHREADS
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#endif
+
 /*------------------------------------------------------------------------*/
 
 namespace CaDiCaL {
@@ -21,6 +30,446 @@ namespace CaDiCaL {
 
 /*------------------------------------------------------------------------*/
 
+#ifndef NTHREADS
+
+// In portfolio mode ('-j <threads>') several differently configured solvers
+// are run on the same formula in parallel threads.  The first solver which
+// determines satisfiability wins and all the others are terminated.  Short
+// learned clauses are exported through the 'Learner' interface and pushed
+// to the lock-free import buffers of all other solvers, which import them
+// at restarts (see 'Solver::import_clause').
+
+// In deterministic mode ('--deterministic') the workers synchronize at a
+// barrier after every 'period' learned clauses.  Exported clauses are only
+// collected during such a round and pushed to the other workers at the
+// barrier in the order of worker identifiers, while all workers are
+// waiting.  Since the terminator (and thus the barrier) is called at fixed
+// points of the search, independently of timing, the imported clauses and
+// thus the whole run only depend on the number of threads.  The winner is
+// the worker with the smallest identifier among those which solved the
+// formula in the same round.  Only the time limit '-t' breaks this.
+
+struct Portfolio;
+
+struct Worker : public Terminator, public Learner {
+
+  Portfolio *portfolio;
+  Solver *solver;
+  int id;
+  string config; // description of diversifying options
+  int res;       // result of 'solve'
+  double time;   // wall-clock time spent in 'solve'
+
+  vector<int> exporting; // literals of currently exported clause
+  vector<int> buffer;    // exported in this round (deterministic mode)
+
+  int64_t learned; // number of learned clauses
+  int64_t barrier; // synchronize if 'learned' reaches it
+  int64_t exported, dropped;
+
+  Worker (Portfolio *, Solver *s, int i);
+
+  bool terminate ();
+  bool learning (int size);
+  void learn (int lit);
+  void share (const vector<int> &clause);
+};
+
+struct Portfolio {
+
+  static const int share_size = 8;         // maximum size of shared clauses
+  static const int64_t round_size = 1000; // learned clauses per round
+
+  int max_var;            // only variables in the original formula
+  int64_t period;         // learned clauses per round (if deterministic)
+  volatile bool *timesup; // set by the alarm handler of the app
+  std::atomic<bool> done; // some worker solved the formula
+  Worker *winner;         // first worker to solve the formula
+  vector<Worker *> workers;
+
+  std::mutex mutex; // protects 'winner' and the barrier
+  std::condition_variable synchronized;
+  int arrived, finished; // workers at the barrier or done
+  int64_t rounds;        // completed rounds
+
+  Portfolio (int m, bool deterministic, volatile bool *t)
+      : max_var (m), period (deterministic ? round_size : 0), timesup (t),
+        done (false), winner (0), arrived (0), finished (0), rounds (0) {}
+  ~Portfolio () {
+    for (auto worker : workers)
+      delete worker;
+  }
+
+  void synchronize ();
+  void complete ();
+  void run (Worker *);
+  int solve ();
+};
+
+Worker::Worker (Portfolio *p, Solver *s, int i)
+    : portfolio (p), solver (s), id (i), res (0), time (0), learned (0),
+      barrier (p->period), exported (0), dropped (0) {}
+
+bool Worker::terminate () {
+  if (portfolio->period && learned >= barrier) {
+    barrier += portfolio->period;
+    portfolio->synchronize ();
+  }
+  return portfolio->done || *portfolio->timesup;
+}
+
+// Units and short clauses are exported but the empty clause is not, since
+// then the exporting worker is done anyhow.
+
+bool Worker::learning (int size) {
+  learned++;
+  return size > 0 && size <= Portfolio::share_size;
+}
+
+// Clauses over variables introduced by the solver itself (for instance in
+// 'factor') have a different meaning in other solvers and are not shared.
+
+void Worker::learn (int lit) {
+  if (lit) {
+    exporting.push_back (lit);
+    return;
+  }
+  bool shareable = true;
+  for (const auto &other : exporting)
+    if (abs (other) > portfolio->max_var)
+      shareable = false;
+  if (shareable) {
+    if (portfolio->period) {
+      for (const auto &other : exporting)
+        buffer.push_back (other);
+      buffer.push_back (0);
+    } else
+      share (exporting);
+    exported++;
+  }
+  exporting.clear ();
+}
+
+// If the import buffer of another worker is full the clause is dropped.
+
+void Worker::share (const vector<int> &clause) {
+  for (auto worker : portfolio->workers)
+    if (worker != this && !worker->solver->import_clause (clause))
+      dropped++;
+}
+
+// Wait until all workers which are not done yet arrived at the barrier.
+// The last arriving (or finishing) worker completes the round.
+
+void Portfolio::synchronize () {
+  std::unique_lock<std::mutex> lock (mutex);
+  const int64_t round = rounds;
+  if (++arrived + finished == (int) workers.size ())
+    complete ();
+  else
+    synchronized.wait (lock, [this, round] { return rounds != round; });
+}
+
+// Called with 'mutex' locked after all workers arrived at the barrier or
+// are done, thus no other worker is running.
+
+void Portfolio::complete () {
+  vector<int> clause;
+  for (auto worker : workers) {
+    if (!winner && worker->res)
+      winner = worker;
+    for (const auto &lit : worker->buffer)
+      if (lit)
+        clause.push_back (lit);
+      else {
+        worker->share (clause);
+        clause.clear ();
+      }
+    worker->buffer.clear ();
+  }
+  if (winner)
+    done = true;
+  arrived = 0;
+  rounds++;
+  synchronized.notify_all ();
+}
+
+void Portfolio::run (Worker *worker) {
+  const double start = absolute_real_time ();
+  const int res = worker->solver->solve ();
+  worker->time = absolute_real_time () - start;
+  std::lock_guard<std::mutex> guard (mutex);
+  worker->res = res;
+  if (period) {
+    if (arrived + ++finished == (int) workers.size ())
+      complete ();
+    return;
+  }
+  if (!res)
+    return;
+  if (!winner)
+    winner = worker;
+  done = true;
+}
+
+int Portfolio::solve () {
+  for (auto worker : workers) {
+    worker->solver->connect_terminator (worker);
+    worker->solver->connect_learner (worker);
+  }
+  vector<std::thread> threads;
+  for (auto worker : workers)
+    threads.push_back (std::thread (&Portfolio::run, this, worker));
+  for (auto &thread : threads)
+    thread.join ();
+  for (auto worker : workers) {
+    worker->solver->disconnect_terminator ();
+    worker->solver->disconnect_learner ();
+  }
+  return winner ? winner->res : 0;
+}
+
+/*------------------------------------------------------------------------*/
+
+// In cube-and-conquer mode ('-C <depth>') the formula is first split by
+// lookahead into cubes of the given depth (see 'generate_cubes').  These
+// are then solved under assumptions by incremental solvers in a pool of
+// threads ('-j <threads>').  Each worker has its own double ended queue of
+// cubes.  It takes the most recently split cube from the back of its own
+// queue and, if that is empty, steals the oldest cube from the front of
+// the queue of another worker (which is the largest piece of work left).
+
+// Every cube is solved with a conflict limit.  If the limit is hit the cube
+// is split again by lookahead and the resulting cubes are put back into
+// the queue of the worker.  The conflict limit is doubled for those cubes,
+// and for the cube itself if it could not be split, which guarantees that
+// eventually each cube is refuted or satisfied.  The pool stops as soon a
+// satisfiable cube is found and the formula is unsatisfiable if all cubes
+// have been refuted.
+
+struct Conquer;
+
+struct Cube {
+  vector<int> literals;
+  int64_t limit; // conflict limit for solving this cube
+};
+
+struct Cuber : public Terminator {
+
+  Conquer *conquer;
+  Solver *solver;
+  int id;
+  double time; // wall-clock time spent in this worker
+
+  std::mutex mutex; // protects 'cubes'
+  std::deque<Cube> cubes;
+
+  int64_t solved, refuted, split, stolen;
+
+  Cuber (Conquer *c, Solver *s, int i)
+      : conquer (c), solver (s), id (i), time (0), solved (0), refuted (0),
+        split (0), stolen (0) {}
+
+  bool terminate ();
+  bool next (Cube &);
+  void conquer_cube (Cube &);
+};
+
+struct Conquer {
+
+  static const int64_t initial_limit = 1000; // conflicts per cube
+  static const int split_depth = 2;          // of inconclusive cubes
+
+  volatile bool *timesup;       // set by the alarm handler of the app
+  std::atomic<bool> done;       // some worker satisfied a cube
+  std::atomic<int64_t> pending; // cubes neither refuted nor satisfied
+  Cuber *winner;                // worker which satisfied a cube
+  vector<Cuber *> workers;
+
+  // Idle workers wait for 'events' to change, which happens whenever
+  // cubes are put back into a queue, 'pending' drops or 'done' is set.
+  // The wait is bounded to notice 'timesup' set by the alarm handler.
+  //
+  std::mutex mutex; // protects 'winner' and 'events'
+  std::condition_variable wakeup;
+  uint64_t events;
+
+  Conquer (volatile bool *t)
+      : timesup (t), done (false), pending (0), winner (0), events (0) {}
+  ~Conquer () {
+    for (auto worker : workers)
+      delete worker;
+  }
+
+  uint64_t observe ();
+  void notify ();
+  void satisfied (Cuber *);
+  void refuted (Cuber *);
+  void run (Cuber *);
+  int solve ();
+};
+
+bool Cuber::terminate () { return conquer->done || *conquer->timesup; }
+
+// Take the next cube from our own queue or otherwise steal one.
+
+bool Cuber::next (Cube &cube) {
+  {
+    std::lock_guard<std::mutex> guard (mutex);
+    if (!cubes.empty ()) {
+      cube = std::move (cubes.back ());
+      cubes.pop_back ();
+      return true;
+    }
+  }
+  const vector<Cuber *> &workers = conquer->workers;
+  const size_t size = workers.size ();
+  for (size_t i = 1; i < size; i++) {
+    Cuber *victim = workers[(id + i) % size];
+    std::lock_guard<std::mutex> guard (victim->mutex);
+    if (victim->cubes.empty ())
+      continue;
+    cube = std::move (victim->cubes.front ());
+    victim->cubes.pop_front ();
+    stolen++;
+    return true;
+  }
+  return false;
+}
+
+void Cuber::conquer_cube (Cube &cube) {
+  for (const auto &lit : cube.literals)
+    solver->assume (lit);
+  solver->limit ("conflicts", cube.limit);
+  int res = solver->solve ();
+  solved++;
+  if (res == 10) {
+    conquer->satisfied (this);
+    return;
+  }
+  if (res == 20) {
+    conquer->refuted (this);
+    return;
+  }
+  if (terminate ())
+    return;
+  for (const auto &lit : cube.literals)
+    solver->assume (lit);
+  const auto generated = solver->generate_cubes (Conquer::split_depth);
+  solver->reset_assumptions ();
+  if (generated.status == 20) {
+    conquer->refuted (this);
+    return;
+  }
+  if (generated.status == 10) {
+
+    // Lookahead satisfied the cube while simplifying it, but this does not
+    // leave the model in the solver.  Solving the cube once more without
+    // conflict limit is cheap now and only needed to obtain the witness.
+
+    for (const auto &lit : cube.literals)
+      solver->assume (lit);
+    res = solver->solve ();
+    if (res == 10)
+      conquer->satisfied (this);
+    return;
+  }
+  const auto &split_cubes = generated.cubes;
+
+  // Lookahead might also refute all sub-cubes without learning that the
+  // cube itself is inconsistent, which leaves no cube to split into.
+
+  if (split_cubes.empty ()) {
+    conquer->refuted (this);
+    return;
+  }
+  const int64_t limit = 2 * cube.limit;
+  {
+    std::lock_guard<std::mutex> guard (mutex);
+    if (split_cubes.size () > 1) {
+      this->split++;
+      conquer->pending += (int64_t) split_cubes.size () - 1;
+      for (const auto &literals : split_cubes)
+        cubes.push_back (Cube{literals, limit});
+    } else {
+      cube.limit = limit;
+      cubes.push_back (std::move (cube));
+    }
+  }
+  conquer->notify ();
+}
+
+uint64_t Conquer::observe () {
+  std::lock_guard<std::mutex> guard (mutex);
+  return events;
+}
+
+void Conquer::notify () {
+  {
+    std::lock_guard<std::mutex> guard (mutex);
+    events++;
+  }
+  wakeup.notify_all ();
+}
+
+void Conquer::satisfied (Cuber *worker) {
+  {
+    std::lock_guard<std::mutex> guard (mutex);
+    if (!winner)
+      winner = worker;
+    done = true;
+    events++;
+  }
+  wakeup.notify_all ();
+}
+
+void Conquer::refuted (Cuber *worker) {
+  worker->refuted++;
+  pending--;
+  notify ();
+}
+
+// The events are observed before looking for a cube, thus cubes put back
+// after an unsuccessful search always wake up the worker.
+
+void Conquer::run (Cuber *worker) {
+  const double start = absolute_real_time ();
+  Cube cube;
+  while (!worker->terminate () && pending) {
+    const uint64_t observed = observe ();
+    if (worker->next (cube)) {
+      worker->conquer_cube (cube);
+      continue;
+    }
+    std::unique_lock<std::mutex> lock (mutex);
+    wakeup.wait_for (lock, std::chrono::milliseconds (100), [&] {
+      return events != observed || done || !pending;
+    });
+  }
+  worker->time = absolute_real_time () - start;
+}
+
+int Conquer::solve () {
+  for (auto worker : workers)
+    worker->solver->connect_terminator (worker);
+  vector<std::thread> threads;
+  for (auto worker : workers)
+    threads.push_back (std::thread (&Conquer::run, this, worker));
+  for (auto &thread : threads)
+    thread.join ();
+  for (auto worker : workers)
+    worker->solver->disconnect_terminator ();
+  if (winner)
+    return 10;
+  if (!pending)
+    return 20;
+  return 0;
+}
+
+#endif
+
+/*------------------------------------------------------------------------*/
+
 class App : public Handler, public Terminator {
 
   Solver *solver; // Global solver.
@@ -30,6 +479,11 @@ class App : public Handler, public Terminator {
   //
   int time_limit; // '-t <sec>'
 #endif
+#ifndef NTHREADS
+  int threads;        // '-j <threads>'
+  int cube_depth;     // '-C <depth>'
+  bool deterministic; // '--deterministic'
+#endif
 
   // Strictness of (DIMACS) parsing:
   //
@@ -55,6 +509,18 @@ class App : public Handler, public Terminator {
   void print_usage (bool all = false);
   void print_witness (FILE *);
 
+#ifndef NTHREADS
+  // Portfolio mode.
+  //
+  void diversify (Solver *, int id, string &config);
+  int solve_portfolio (int conflict_limit, int decision_limit,
+                       int preprocessing, int localsearch);
+
+  // Cube-and-conquer mode.
+  //
+  int solve_cubes ();
+#endif
+
 #ifndef QUIET
   void signal_message (const char *msg, int sig);
 #endif
@@ -118,6 +584,9 @@ void App::print_usage (bool all) {
 "\n"
 #ifndef _WIN32
 "  -t <sec>       set wall clock time limit\n"
+#endif
+#ifndef NTHREADS
+"  -j <threads>   number of portfolio solver threads (default '1')\n"
 #endif
 
            );
@@ -136,6 +605,9 @@ void App::print_usage (bool all) {
 #ifndef _WIN32
 "  -t <sec>       set wall clock time limit\n"
 #endif
+#ifndef NTHREADS
+"  -j <threads>   number of portfolio solver threads (default '1')\n"
+#endif
 "\n"
 "Or '<option>' is one of the less common options\n"
 "\n"
@@ -148,6 +620,14 @@ void App::print_usage (bool all) {
 "\n"
 "  -c <limit>     limit the number of conflicts (default unlimited)\n"
 "  -d <limit>     limit the number of decisions (default unlimited)\n"
+#ifndef NTHREADS
+"  -C <depth>     cube-and-conquer on lookahead cubes of this depth\n"
+"                 solved by '-j <threads>' threads\n"
+"\n"
+"  --deterministic\n"
+"                 synchronize portfolio threads ('-j <threads>')\n"
+"                 to make runs reproducible\n"
+#endif
 "\n"
 "  -o <output>    write simplified CNF in DIMACS format to file\n"
 "  -e <extend>    write reconstruction/extension stack to file\n"
@@ -292,6 +772,223 @@ void App::print_witness (FILE *file) {
 
 /*------------------------------------------------------------------------*/
 
+#ifndef NTHREADS
+
+// The first worker uses the options given by the user.  All other workers
+// use a different random seed and shuffle variables during rephasing.
+// Every second worker flips the initial phase and they alternate between
+// the user options and the 'sat' and 'unsat' configurations.  Options can
+// only be set right after initialization and 'Solver::copy' would copy the
+// options of the user too.  Thus the workers are configured first and then
+// the formula is added clause by clause.  Since the original solver has
+// not been used for solving yet, there are no witnesses nor variable flags
+// which would need to be copied too.
+
+struct WorkerCopier : public ClauseIterator {
+  Solver *dst;
+  WorkerCopier (Solver *d) : dst (d) {}
+  bool clause (const vector<int> &c) {
+    for (const auto &lit : c)
+      dst->add (lit);
+    dst->add (0);
+    return true;
+  }
+};
+
+void App::diversify (Solver *worker, int id, string &config) {
+  assert (id > 0);
+  for (Options::iterator o = Options::begin (); o != Options::end (); o++)
+    worker->set (o->name, solver->get (o->name));
+  switch ((id / 2) % 3) {
+  case 1:
+    worker->configure ("sat");
+    config = "sat";
+    break;
+  case 2:
+    worker->configure ("unsat");
+    config = "unsat";
+    break;
+  default:
+    config = "default";
+    break;
+  }
+  worker->set ("seed", id);
+  worker->set ("shuffle", 1);
+  worker->set ("shufflerandom", 1);
+  if (id & 1)
+    worker->set ("phase", !worker->get ("phase"));
+  config += " seed=" + std::to_string (id);
+  config += " phase=" + std::to_string (worker->get ("phase"));
+  WorkerCopier copier (worker);
+  solver->traverse_clauses (copier);
+}
+
+int App::solve_portfolio (int conflict_limit, int decision_limit,
+                          int preprocessing, int localsearch) {
+  solver->section ("portfolio");
+  const int quiet = get ("quiet");
+  Portfolio portfolio (max_var, deterministic, &timesup);
+  for (int id = 0; id < threads; id++) {
+    Solver *worker_solver;
+    string config;
+    if (id) {
+      worker_solver = new Solver ();
+      diversify (worker_solver, id, config);
+      worker_solver->set ("quiet", 1);
+      if (conflict_limit >= 0)
+        worker_solver->limit ("conflicts", conflict_limit);
+      if (decision_limit >= 0)
+        worker_solver->limit ("decisions", decision_limit);
+      if (preprocessing > 0)
+        worker_solver->limit ("preprocessing", preprocessing);
+      if (localsearch > 0)
+        worker_solver->limit ("localsearch", localsearch);
+    } else {
+      worker_solver = solver;
+      config = "user";
+    }
+    Worker *worker = new Worker (&portfolio, worker_solver, id);
+    worker->config = config;
+    portfolio.workers.push_back (worker);
+    solver->message ("worker %d configuration: %s", id,
+                     worker->config.c_str ());
+  }
+  solver->message ("starting %d %sportfolio solver threads", threads,
+                   deterministic ? "deterministic " : "");
+  solver->section ("solving");
+  const double start = absolute_real_time ();
+  const double process = absolute_process_time ();
+  const int res = portfolio.solve ();
+  const double wall_clock_time = absolute_real_time () - start;
+  const double process_time = absolute_process_time () - process;
+
+  solver->section ("portfolio");
+  int64_t exported = 0, dropped = 0, imported = 0;
+  for (auto worker : portfolio.workers) {
+    const char *result = worker->res == 10   ? "SATISFIABLE"
+                         : worker->res == 20 ? "UNSATISFIABLE"
+                                             : "UNKNOWN";
+    const Stats &stats = worker->solver->internal->stats;
+    const int64_t worker_imported =
+        stats.imported.clauses + stats.imported.units;
+    solver->message ("worker %d %s in %.2f sec after %" PRId64
+                     " conflicts exported %" PRId64 " imported %" PRId64
+                     "%s",
+                     worker->id, result, worker->time, stats.conflicts,
+                     worker->exported, worker_imported,
+                     worker == portfolio.winner ? " (winner)" : "");
+    exported += worker->exported;
+    dropped += worker->dropped;
+    imported += worker_imported;
+  }
+  solver->message ("exported %" PRId64 " and imported %" PRId64
+                   " clauses in total (%" PRId64 " dropped)",
+                   exported, imported, dropped);
+  solver->message ("%.2f sec wall-clock and %.2f sec process time "
+                   "(%.2f utilization)",
+                   wall_clock_time, process_time,
+                   relative (process_time, wall_clock_time));
+
+  // Continue with the winner as solver for printing the witness and the
+  // statistics and delete all the other solvers.
+
+  Solver *winner = portfolio.winner ? portfolio.winner->solver : solver;
+  for (auto worker : portfolio.workers) {
+    if (worker->solver == winner)
+      continue;
+    if (worker->solver == solver)
+      solver = winner;
+    delete worker->solver;
+  }
+  if (winner->get ("quiet") != quiet)
+    winner->set ("quiet", quiet);
+  return res;
+}
+
+// If lookahead already solves the formula or does not produce any cube we
+// fall back to solve the formula directly.  Otherwise the generated cubes
+// are distributed round-robin over the queues of the workers.
+
+int App::solve_cubes () {
+  solver->section ("lookahead");
+  const auto generated = solver->generate_cubes (cube_depth);
+  const size_t size = generated.cubes.size ();
+  if (generated.status || !size) {
+    solver->message ("lookahead did not generate any cube");
+    solver->section ("solving");
+    return solver->solve ();
+  }
+  solver->message ("generated %zu cubes of depth %d", size, cube_depth);
+  solver->section ("cube-and-conquer");
+  const int quiet = get ("quiet");
+  Conquer conquer (&timesup);
+  for (int id = 0; id < threads; id++) {
+    Solver *worker_solver;
+    if (id) {
+      worker_solver = new Solver ();
+      solver->copy (*worker_solver);
+    } else
+      worker_solver = solver;
+    conquer.workers.push_back (new Cuber (&conquer, worker_solver, id));
+  }
+  for (size_t i = 0; i < size; i++) {
+    Cuber *worker = conquer.workers[i % threads];
+    Cube cube{generated.cubes[i], Conquer::initial_limit};
+    worker->cubes.push_back (cube);
+  }
+  conquer.pending = size;
+  solver->message ("starting %d cube-and-conquer solver threads", threads);
+  for (auto worker : conquer.workers)
+    worker->solver->set ("quiet", 1);
+  const double start = absolute_real_time ();
+  const double process = absolute_process_time ();
+  const int res = conquer.solve ();
+  const double wall_clock_time = absolute_real_time () - start;
+  const double process_time = absolute_process_time () - process;
+  solver->set ("quiet", quiet);
+
+  solver->section ("cube-and-conquer");
+  int64_t solved = 0, refuted = 0, split = 0, stolen = 0;
+  for (auto worker : conquer.workers) {
+    solver->message ("worker %d solved %" PRId64 " refuted %" PRId64
+                     " split %" PRId64 " stole %" PRId64
+                     " cubes in %.2f sec%s",
+                     worker->id, worker->solved, worker->refuted,
+                     worker->split, worker->stolen, worker->time,
+                     worker == conquer.winner ? " (winner)" : "");
+    solved += worker->solved;
+    refuted += worker->refuted;
+    split += worker->split;
+    stolen += worker->stolen;
+  }
+  solver->message ("solved %" PRId64 " refuted %" PRId64 " split %" PRId64
+                   " and stole %" PRId64 " cubes in total",
+                   solved, refuted, split, stolen);
+  solver->message ("%.2f sec wall-clock and %.2f sec process time "
+                   "(%.2f utilization)",
+                   wall_clock_time, process_time,
+                   relative (process_time, wall_clock_time));
+
+  // Continue with the winner as solver for printing the witness and the
+  // statistics and delete all the other solvers.
+
+  Solver *winner = conquer.winner ? conquer.winner->solver : solver;
+  for (auto worker : conquer.workers) {
+    if (worker->solver == winner)
+      continue;
+    if (worker->solver == solver)
+      solver = winner;
+    delete worker->solver;
+  }
+  if (winner->get ("quiet") != quiet)
+    winner->set ("quiet", quiet);
+  return res;
+}
+
+#endif
+
+/*------------------------------------------------------------------------*/
+
 // Wrapper around option setting.
 
 int App::get (const char *o) { return solver->get (o); }
@@ -389,6 +1086,10 @@ int App::main (int argc, char **argv) {
   const char *localsearch_specified = 0;
 #ifndef __MINGW32__
   const char *time_limit_specified = 0;
+#endif
+#ifndef NTHREADS
+  const char *threads_specified = 0;
+  const char *cube_depth_specified = 0;
 #endif
   bool witness = true, less = false, status = true;
   const char *dimacs_name, *err;
@@ -516,6 +1217,33 @@ int App::main (int argc, char **argv) {
         time_limit_specified = argv[i];
     }
 #endif
+#ifndef NTHREADS
+    else if (!strcmp (argv[i], "-j")) {
+      if (++i == argc)
+        APPERR ("argument to '-j' missing");
+      else if (threads_specified)
+        APPERR ("multiple thread options '-j %s' and '-j %s'",
+                threads_specified, argv[i]);
+      else if (!parse_int_str (argv[i], threads))
+        APPERR ("invalid argument in '-j %s'", argv[i]);
+      else if (threads < 1)
+        APPERR ("invalid number of threads");
+      else
+        threads_specified = argv[i];
+    } else if (!strcmp (argv[i], "-C")) {
+      if (++i == argc)
+        APPERR ("argument to '-C' missing");
+      else if (cube_depth_specified)
+        APPERR ("multiple cube depth options '-C %s' and '-C %s'",
+                cube_depth_specified, argv[i]);
+      else if (!parse_int_str (argv[i], cube_depth))
+        APPERR ("invalid argument in '-C %s'", argv[i]);
+      else if (cube_depth < 1)
+        APPERR ("invalid cube depth");
+      else
+        cube_depth_specified = argv[i];
+    }
+#endif
 #ifndef QUIET
     else if (!strcmp (argv[i], "-q"))
       set ("--quiet");
@@ -530,6 +1258,12 @@ int App::main (int argc, char **argv) {
              !strcmp (argv[i], "--force=1") ||
              !strcmp (argv[i], "--force=true"))
       force_strict_parsing = 0, force_writing = true;
+#ifndef NTHREADS
+    else if (!strcmp (argv[i], "--deterministic") ||
+             !strcmp (argv[i], "--deterministic=1") ||
+             !strcmp (argv[i], "--deterministic=true"))
+      deterministic = true;
+#endif
     else if (!strcmp (argv[i], "--strict") ||
              !strcmp (argv[i], "--strict=1") ||
              !strcmp (argv[i], "--strict=true"))
@@ -594,6 +1328,26 @@ int App::main (int argc, char **argv) {
       !strcmp (dimacs_path, proof_path) && strcmp (dimacs_path, "-"))
     APPERR ("DIMACS input file '%s' also specified as DRAT proof file",
             dimacs_path);
+#ifndef NTHREADS
+  if (threads > 1 && proof_specified)
+    APPERR ("can not combine '-j %s' with proof tracing",
+            threads_specified);
+  if (cube_depth_specified && conflict_limit_specified)
+    APPERR ("can not combine '-C %s' with '-c %s'", cube_depth_specified,
+            conflict_limit_specified);
+  if (cube_depth_specified && decision_limit_specified)
+    APPERR ("can not combine '-C %s' with '-d %s'", cube_depth_specified,
+            decision_limit_specified);
+  if (cube_depth_specified && deterministic)
+    APPERR ("can not combine '-C %s' with '--deterministic'",
+            cube_depth_specified);
+  if (cube_depth_specified && preprocessing_specified)
+    APPERR ("can not combine '-C %s' with '%s'", cube_depth_specified,
+            preprocessing_specified);
+  if (cube_depth_specified && localsearch_specified)
+    APPERR ("can not combine '-C %s' with '%s'", cube_depth_specified,
+            localsearch_specified);
+#endif
 
   /*----------------------------------------------------------------------*/
   // The '--less' option is not fully functional yet (it is also not
@@ -736,6 +1490,15 @@ int App::main (int argc, char **argv) {
 
   int res = 0;
 
+#ifndef NTHREADS
+  if (threads > 1 && incremental)
+    APPERR ("can not combine '-j %s' with incremental solving",
+            threads_specified);
+  if (cube_depth_specified && incremental)
+    APPERR ("can not combine '-C %s' with incremental solving",
+            cube_depth_specified);
+#endif
+
   if (incremental) {
     bool reporting = get ("report") > 1 || get ("verbose") > 0;
     if (!reporting)
@@ -859,7 +1622,15 @@ int App::main (int argc, char **argv) {
 
     if (inconclusive && res == 20)
       res = 0;
-  } else {
+  }
+#ifndef NTHREADS
+  else if (cube_depth)
+    res = solve_cubes ();
+  else if (threads > 1)
+    res = solve_portfolio (conflict_limit, decision_limit, preprocessing,
+                           localsearch);
+#endif
+  else {
     solver->section ("solving");
     res = solver->solve ();
   }
@@ -943,6 +1714,11 @@ void App::init () {
 
 #ifndef _WIN32
   time_limit = -1;
+#endif
+#ifndef NTHREADS
+  threads = 1;
+  cube_depth = 0;
+  deterministic = false;
 #endif
   force_strict_parsing = 1;
   force_writing = false;
@@ -223,6 +223,7 @@ struct External;
 // Forward declaration of call-back classes. See bottom of this file.
 
 class Learner;
+class Importer;
 class FixedAssignmentListener;
 class Terminator;
 class ClauseIterator;
@@ -390,6 +391,30 @@ public:
 
   // ====== END IPASIR =====================================================
 
+  // Add call-back which allows to import clauses (learned by other solvers
+  // working on the same formula) at restarts.  Nothing is imported while
+  // tracing proofs or checking learned clauses, since the imported clauses
+  // can not be justified.
+  //
+  //   require (VALID)
+  //   ensure (VALID)
+  //
+  void connect_importer (Importer *importer);
+  void disconnect_importer ();
+
+  // Thread-safe import of a clause.  In contrast to all other functions
+  // this one can be called from any thread at any time, even while this
+  // solver is solving in another thread.  The clause is copied into a
+  // lock-free buffer and imported as redundant clause the next time the
+  // search of this solver is at the root-level (usually at restarts).  As
+  // for the 'Importer' the clause has to be implied by the original
+  // formula, tautologies and clauses with unknown, eliminated or
+  // substituted variables are skipped and nothing is imported while
+  // tracing proofs.  Returns 'false' if the buffer is full and the clause
+  // has been dropped.  Calls to this function are not traced.
+  //
+  bool import_clause (const std::vector<int> &clause);
+
   // Add call-back which allows to observe when a variable is fixed.
   //
   //   require (VALID)
@@ -1256,6 +1281,20 @@ public:
   virtual void learn (int lit) = 0;
 };
 
+// Connected importers are asked at restarts whether clauses are available
+// for import.  As long 'importing' returns true the literals of the next
+// clause are requested through 'import' one by one until a zero literal is
+// returned.  Imported clauses have to be implied by the original formula
+// and are added as redundant clauses.  Clauses with variables which are
+// unknown, eliminated or substituted in this solver are skipped.
+
+class Importer {
+public:
+  virtual ~Importer () {}
+  virtual bool importing () = 0;
+  virtual int import () = 0;
+};
+
 // Connected listener gets notified whenever the truth value of a variable
 // is fixed (for example during inprocessing or due to derived unit
 // clauses).
@@ -75,6 +75,38 @@ void Internal::mark_added (Clause *c) {
 
 /*------------------------------------------------------------------------*/
 
+// Small clauses are allocated in the slab allocator (see 'slab.hpp') and
+// larger ones on the heap.  The 'slab' field is the only field set here.
+
+Clause *Internal::allocate_clause (size_t bytes) {
+  const unsigned size_class = opts.slab ? Slab::size_class (bytes) : 0;
+  Clause *res;
+  if (size_class) {
+    res = (Clause *) slab.allocate (size_class);
+    stats.slab.allocated++;
+    stats.slab.bytes += bytes;
+  } else {
+    res = (Clause *) new char[bytes];
+    stats.slab.heap++;
+  }
+  res->slab = size_class;
+  return res;
+}
+
+// Deallocates the clause in case of an exception, e.g., if pushing it on
+// 'clauses' fails, unless released.
+
+struct DeferDeallocateClause {
+  Internal *internal;
+  Clause *clause;
+  DeferDeallocateClause (Internal *i, Clause *c) : internal (i), clause (c) {}
+  ~DeferDeallocateClause () {
+    if (clause)
+      internal->deallocate_clause (clause);
+  }
+  void release () { clause = nullptr; }
+};
+
 Clause *Internal::new_clause (bool red, int glue) {
 
   assert (clause.size () <= (size_t) INT_MAX);
@@ -85,8 +117,8 @@ Clause *Internal::new_clause (bool red, int glue) {
     glue = size;
 
   size_t bytes = Clause::bytes (size);
-  Clause *c = (Clause *) new char[bytes];
-  DeferDeleteArray<char> clause_delete ((char *) c);
+  Clause *c = allocate_clause (bytes);
+  DeferDeallocateClause clause_delete (this, c);
 
   c->id = ++clause_id;
 
@@ -242,14 +274,17 @@ size_t Internal::shrink_clause (Clause *c, int new_size) {
 
 // This is the 'raw' deallocation of a clause.  If the clause is in the
 // arena nothing happens.  If the clause is not in the arena its memory is
-// reclaimed immediately.
+// reclaimed immediately (given back to the slab allocator or the heap).
 
 void Internal::deallocate_clause (Clause *c) {
   char *p = (char *) c;
   if (arena.contains (p))
     return;
   LOG (c, "deallocate pointer %p", (void *) c);
-  delete[] p;
+  if (c->slab)
+    slab.deallocate (p, c->slab);
+  else
+    delete[] p;
 }
 
 void Internal::delete_clause (Clause *c) {
@@ -550,6 +585,10 @@ Clause *Internal::new_learned_redundant_clause (int glue) {
   }
   assert (watching ());
   watch_clause (res);
+  if (opts.binaryfirst && res->size == 2) {
+    move_last_binary_watch_forward (watches (res->literals[0]));
+    move_last_binary_watch_forward (watches (res->literals[1]));
+  }
   return res;
 }
 
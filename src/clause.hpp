@@ -26,6 +26,16 @@ typedef const int *const_literal_iterator;
 // to store the actual literals somewhere else, which not only needs more
 // memory but more importantly also requires another memory access and thus
 // is very costly.
+//
+// Only 'garbage', 'size', 'pos' and the literals are accessed during
+// propagation.  They are placed after the 'id' and thus form a contiguous
+// block with the literals.  Since clauses are 8 byte aligned, this block
+// starts at an 8 byte boundary and the 'id' field in front of it never
+// adds a cache line to those touched in propagation (it is either on the
+// same cache line or on a line not touched at all).  Moving 'id' and the
+// rarely used flags into a side table would thus only save memory but
+// would require another indirection for every LRAT proof step, and the
+// 'id' is needed even without proofs (e.g., for 'incremental_decay').
 
 #define USED_SIZE 5
 struct Clause {
@@ -40,6 +50,7 @@ struct Clause {
   };
   unsigned used
       : USED_SIZE;      // resolved in conflict analysis since last 'reduce'
+  unsigned slab : 6;    // size class in 'Slab' (zero if not allocated there)
   bool conditioned : 1; // Tried for globally blocked clause elimination.
   bool covered : 1;  // Already considered for covered clause elimination.
   bool enqueued : 1; // Enqueued on backward queue.
@@ -222,7 +222,7 @@ inline void Internal::flush_watches (int lit, Watches &saved) {
   for (const auto &w : saved)
     ws.push_back (w);
   saved.clear ();
-  shrink_vector (ws);
+  shrink_watches (ws);
 }
 
 void Internal::flush_all_occs_and_watches () {
@@ -253,9 +253,12 @@ void Internal::update_reason_references () {
       continue;
     if (c == external_reason)
       continue;
-    LOG (c, "updating assigned %d reason", lit);
     assert (c->reason);
-    assert (c->moved);
+    if (!c->moved) {
+      assert (arena.keeps (c));
+      continue;
+    }
+    LOG (c, "updating assigned %d reason", lit);
     Clause *d = c->copy;
     v.reason = d;
 #ifdef LOGGING
@@ -313,12 +316,71 @@ void Internal::copy_clause (Clause *c) {
   assert (!c->moved);
   char *p = (char *) c;
   char *q = arena.copy (p, c->bytes ());
+  ((Clause *) q)->slab = 0;
   c->copy = (Clause *) q;
   c->moved = true;
   LOG ("copied clause[%" PRId64 "] from %p to %p", c->id, (void *) c,
        (void *) c->copy);
 }
 
+// Select the regions of the arena to be evacuated if 'opts.arenaslice'
+// limits the number of bytes moved in one collection.  Clauses outside of
+// the arena are always moved.  Then regions are evacuated in the order of
+// increasing live bytes, as long the limit is not exceeded, which first
+// reclaims regions with most garbage.  In order to keep 'contains' cheap
+// all regions are evacuated if there are too many.  The result is the
+// number of bytes to be moved.
+
+size_t Internal::select_evacuated_regions () {
+
+  const size_t regions = arena.regions ();
+  vector<size_t> live (regions);
+  size_t res = 0;
+
+  for (const auto &c : clauses) {
+    if (c->collect ())
+      continue;
+    const int i = arena.region (c);
+    if (i < 0)
+      res += c->bytes ();
+    else
+      live[i] += c->bytes ();
+  }
+
+  const size_t max_regions = 8;
+  const size_t slice = (size_t) opts.arenaslice << 20;
+
+  if (!slice || regions >= max_regions) {
+    for (size_t i = 0; i < regions; i++)
+      arena.evacuate (i), res += live[i];
+  } else {
+    vector<int> schedule;
+    for (size_t i = 0; i < regions; i++)
+      schedule.push_back (i);
+    stable_sort (schedule.begin (), schedule.end (),
+                 [&live] (int i, int j) { return live[i] < live[j]; });
+    size_t evacuated = 0;
+    for (const auto i : schedule) {
+      if (live[i] && res + live[i] > slice)
+        break;
+      arena.evacuate (i), res += live[i], evacuated++;
+    }
+    if (evacuated < regions)
+      stats.arena.partial++;
+    if (res > slice)
+      stats.arena.exceeded++;
+  }
+
+  stats.arena.moved += res;
+  return res;
+}
+
+// Is the non garbage clause 'c' not moved yet and should it be moved?
+
+inline bool Internal::moving (Clause *c) {
+  return !c->moved && !c->collect () && !arena.keeps (c);
+}
+
 // This is the moving garbage collector.
 
 void Internal::copy_non_garbage_clauses () {
@@ -326,13 +388,15 @@ void Internal::copy_non_garbage_clauses () {
   size_t collected_clauses = 0, collected_bytes = 0;
   size_t moved_clauses = 0, moved_bytes = 0;
 
-  // First determine 'moved_bytes' and 'collected_bytes'.
+  // First determine the regions to be evacuated, 'moved_bytes' and
+  // 'collected_bytes'.
   //
+  moved_bytes = select_evacuated_regions ();
   for (const auto &c : clauses)
-    if (!c->collect ())
-      moved_bytes += c->bytes (), moved_clauses++;
-    else
+    if (c->collect ())
       collected_bytes += c->bytes (), collected_clauses++;
+    else if (moving (c))
+      moved_clauses++;
 
   PHASE ("collect", stats.collections,
          "moving %zd bytes %.0f%% of %zd non garbage clauses", moved_bytes,
@@ -347,7 +411,7 @@ void Internal::copy_non_garbage_clauses () {
   //
   if (opts.arenacompact)
     for (const auto &c : clauses)
-      if (!c->collect () && arena.contains (c))
+      if (arena.contains (c) && moving (c))
         copy_clause (c);
 
   if (opts.arenatype == 1 || !watching ()) {
@@ -366,7 +430,7 @@ void Internal::copy_non_garbage_clauses () {
     // benefit due to better cache locality.
 
     for (const auto &c : clauses)
-      if (!c->moved && !c->collect ())
+      if (moving (c))
         copy_clause (c);
 
   } else if (opts.arenatype == 2) {
@@ -379,7 +443,7 @@ void Internal::copy_non_garbage_clauses () {
     for (int sign = -1; sign <= 1; sign += 2)
       for (auto idx : vars)
         for (const auto &w : watches (sign * likely_phase (idx)))
-          if (!w.clause->moved && !w.clause->collect ())
+          if (moving (w.clause))
             copy_clause (w.clause);
 
   } else {
@@ -395,7 +459,7 @@ void Internal::copy_non_garbage_clauses () {
     for (int sign = -1; sign <= 1; sign += 2)
       for (int idx = queue.last; idx; idx = link (idx).prev)
         for (const auto &w : watches (sign * likely_phase (idx)))
-          if (!w.clause->moved && !w.clause->collect ())
+          if (moving (w.clause))
             copy_clause (w.clause);
   }
 
@@ -403,7 +467,7 @@ void Internal::copy_non_garbage_clauses () {
   // a rare situation, and now is only left as defensive code.
   //
   for (const auto &c : clauses)
-    if (!c->collect () && !c->moved)
+    if (moving (c))
       copy_clause (c);
 
   flush_all_occs_and_watches ();
@@ -417,8 +481,10 @@ void Internal::copy_non_garbage_clauses () {
     Clause *c = *i;
     if (c->collect ())
       delete_clause (c);
+    else if (c->moved)
+      *j++ = c->copy, deallocate_clause (c);
     else
-      assert (c->moved), *j++ = c->copy, deallocate_clause (c);
+      assert (arena.keeps (c)), *j++ = c;
   }
   clauses.resize (j - clauses.begin ());
   if (clauses.size () < clauses.capacity () / 2)
@@ -474,6 +540,7 @@ void Internal::remove_garbage_binaries () {
   if (unsat)
     return;
   START (collect);
+  clear_saved_trail ();
 
   if (!protected_reasons)
     protect_reasons ();
@@ -528,6 +595,7 @@ void Internal::garbage_collection () {
   START (collect);
   report ('G', 1);
   stats.collections++;
+  clear_saved_trail ();
   mark_satisfied_clauses_as_garbage ();
   if (!protected_reasons)
     protect_reasons ();
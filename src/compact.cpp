@@ -162,6 +162,7 @@ static signed char *ignore_clang_analyze_memory_leak_warning;
 void Internal::compact () {
 
   START (compact);
+  clear_saved_trail ();
 
   assert (active () < max_var);
 
@@ -173,7 +174,6 @@ void Internal::compact () {
   assert (clause.empty ());
   assert (levels.empty ());
   assert (analyzed.empty ());
-  assert (minimized.empty ());
   assert (control.size () == 1);
   assert (propagated == trail.size ());
 
@@ -448,8 +448,8 @@ void Internal::compact () {
 
   mapper.map_vector (i2e);
   mapper.map2_vector (ptab);
-  mapper.map_vector (btab);
   mapper.map_vector (gtab);
+  mapper.map_vector (mtab);
   mapper.map_vector (links);
   mapper.map_vector (vtab);
   if (!ntab.empty ())
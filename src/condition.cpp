@@ -901,6 +901,7 @@ void Internal::condition (bool update_limits) {
 
   START_SIMPLIFIER (condition, CONDITION);
   stats.conditionings++;
+  clear_saved_trail ();
 
   // Propagation limit to avoid too much work in 'condition'.  We mark
   // tried candidate clauses after giving up, such that next time we run
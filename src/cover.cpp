@@ -131,20 +131,9 @@ bool Internal::cover_propagate_asymmetric (int lit, Clause *ignore,
       if (u > 0)
         j[-1].blit = other;
       else {
-        const int size = w.clause->size;
-        const const_literal_iterator end = lits + size;
-        const literal_iterator middle = lits + w.clause->pos;
-        literal_iterator k = middle;
         signed char v = -1;
         int r = 0;
-        while (k != end && (v = val (r = *k)) < 0)
-          k++;
-        if (v < 0) {
-          k = lits + 2;
-          assert (w.clause->pos <= size);
-          while (k != middle && (v = val (r = *k)) < 0)
-            k++;
-        }
+        literal_iterator k = search_replacement (w.clause, r, v);
         w.clause->pos = k - lits;
         assert (lits + 2 <= k), assert (k <= w.clause->end ());
         if (v > 0)
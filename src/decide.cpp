@@ -208,7 +208,7 @@ bool Internal::better_decision (int lit, int other) {
   if (stable)
     return stab[lit_idx] > stab[other_idx];
   else
-    return btab[lit_idx] > btab[other_idx];
+    return links[lit_idx].bumped > links[other_idx].bumped;
 }
 
 // Search for the next decision and assign it to the saved phase.  Requires
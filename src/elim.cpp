@@ -477,6 +477,8 @@ bool Internal::elim_resolvents_are_bounded (Eliminator &eliminator,
   const int64_t neg = ns.size ();
   if (!pos || !neg)
     return lim.elimbound >= 0;
+  if (!substitute && elim_checked_unbounded (eliminator, pivot))
+    return false;
   const int64_t bound = pos + neg + lim.elimbound;
 
   LOG ("checking number resolvents on %d bounded by "
@@ -757,6 +759,300 @@ void Internal::
 
 /*------------------------------------------------------------------------*/
 
+// With 'opts.elimthreads' larger than one candidates are checked in
+// parallel for having too many resolvents before they are tried.  To this
+// end a batch of candidates is taken from the front of the schedule and
+// pushed back, such that they are still tried in the same order.  A batch
+// only contains candidates with disjoint neighborhoods (variables occurring
+// together with the candidate in a clause), where the first candidate with
+// an overlapping neighborhood ends the batch.  Eliminating a candidate thus
+// does not change the clauses of the other candidates in the batch (with
+// the exception of new units and backward subsumption).
+
+// The worker threads only read the occurrence lists and clauses and use
+// their own marks.  They simulate 'resolve_clauses' without its side
+// effects and give up on units, empty resolvents and on-the-fly
+// self-subsuming resolution.  If a candidate is found to have too many
+// resolvents this is only used in 'elim_resolvents_are_bounded' if no
+// gates were found and no units were derived since checking the batch.
+// Otherwise the candidate is tried as without threads.  As the batches
+// and the result of checking them do not depend on the number of threads
+// the outcome is deterministic.
+
+// The workers and their threads are kept in 'ElimCheckers' for the whole
+// elimination round.  Between batches the helper threads wait for the next
+// batch (see 'helpers.cpp').  Scanning the neighborhoods of candidates to
+// build a batch is counted as one resolution per visited clause.
+
+#ifndef NTHREADS
+
+static const size_t elim_batch_size = 1u << 6;
+
+struct ElimWorker {
+
+  Internal *internal;
+  bool fast;
+  vector<signed char> marks; // private marks indexed by variables
+  vector<Clause *> ps, ns;
+
+  ElimWorker (Internal *i, bool f)
+      : internal (i), fast (f), marks (i->max_var + 1, 0) {}
+
+  signed char marked (int lit) const {
+    const signed char res = marks[abs (lit)];
+    return lit < 0 ? -res : res;
+  }
+
+  void flush_satisfied (vector<Clause *> &os) {
+    const auto end = os.end ();
+    auto j = os.begin ();
+    for (auto i = j; i != end; i++) {
+      bool satisfied = false;
+      for (const auto &lit : **i)
+        if (internal->val (lit) > 0)
+          satisfied = true;
+      if (!satisfied)
+        *j++ = *i;
+    }
+    os.resize (j - os.begin ());
+  }
+
+  // Copy non-garbage clauses and return 'false' if the limits checked in
+  // 'try_to_eliminate_variable' respectively 'flush_elimfast_occs' and
+  // 'try_to_fasteliminate_variable' are hit.
+
+  bool collect (int lit, vector<Clause *> &os) {
+    os.clear ();
+    const Options &opts = internal->opts;
+    for (const auto &c : internal->occs (lit)) {
+      if (c->collect ())
+        continue;
+      if (fast && c->size > opts.fastelimocclim)
+        return false;
+      os.push_back (c);
+    }
+    const int64_t occlim = fast ? opts.fastelimbound : opts.elimocclim;
+    if ((int64_t) os.size () > occlim)
+      return false;
+    stable_sort (os.begin (), os.end (), clause_smaller_size ());
+    return true;
+  }
+
+  // Returns the number of resolutions to find too many resolvents on
+  // 'idx' or zero if this could not be determined.
+
+  int64_t check (int idx) {
+    if (!internal->active (idx))
+      return 0;
+    int pivot = idx;
+    if (!collect (pivot, ps) || !collect (-pivot, ns))
+      return 0;
+    if (ps.size () > ns.size ())
+      pivot = -pivot, swap (ps, ns);
+    const int64_t pos = ps.size (), neg = ns.size ();
+    if (!pos || !neg)
+      return 0;
+    const Options &opts = internal->opts;
+    int64_t bound;
+    if (fast)
+      bound = min ((int64_t) opts.fastelimbound, pos + neg);
+    else
+      bound = pos + neg + internal->lim.elimbound;
+    if (pos * neg <= bound)
+      return 0;
+    const int clslim = fast ? opts.fastelimclslim : opts.elimclslim;
+    flush_satisfied (ps);
+    flush_satisfied (ns);
+    int64_t resolutions = 0, resolvents = 0, res = 0;
+    bool done = false;
+    for (const auto &c : ps) {
+      int s = 0, size = 0;
+      for (const auto &lit : *c) {
+        if (lit == pivot)
+          s++;
+        else if (!internal->val (lit))
+          marks[abs (lit)] = lit < 0 ? -1 : 1, s++, size++;
+      }
+      for (const auto &d : ns) {
+        resolutions++;
+        int t = 0, added = 0;
+        bool tautological = false;
+        for (const auto &lit : *d) {
+          if (lit == -pivot) {
+            t++;
+            continue;
+          }
+          if (internal->val (lit))
+            continue;
+          const signed char tmp = marked (lit);
+          if (tmp < 0) {
+            tautological = true;
+            break;
+          }
+          if (!tmp)
+            added++;
+          t++;
+        }
+        if (tautological)
+          continue;
+        const int resolvent = size + added;
+        if (resolvent < 2 || s > resolvent || t > resolvent)
+          done = true;
+        else if (resolvent > clslim || ++resolvents > bound)
+          res = resolutions, done = true;
+        if (done)
+          break;
+      }
+      for (const auto &lit : *c)
+        marks[abs (lit)] = 0;
+      if (done)
+        break;
+    }
+    return res;
+  }
+
+  void run (const vector<int> *batch, size_t offset, size_t threads,
+            vector<int64_t> *unbounded) {
+    for (size_t i = offset; i < batch->size (); i += threads) {
+      const int idx = (*batch)[i];
+      (*unbounded)[idx] = check (idx);
+    }
+  }
+};
+
+struct ElimCheckers : public HelperJob {
+
+  vector<ElimWorker> workers; // first one used by the solver thread
+  Helpers helpers;
+
+  const vector<int> *batch; // current batch
+  vector<int64_t> *unbounded;
+
+  ElimCheckers (Internal *internal, bool fast, size_t threads)
+      : helpers (threads), batch (0), unbounded (0) {
+    for (size_t t = 0; t < threads; t++)
+      workers.push_back (ElimWorker (internal, fast));
+  }
+
+  void work (size_t t) {
+    workers[t].run (batch, t, workers.size (), unbounded);
+  }
+
+  void check (const vector<int> &b, vector<int64_t> &u) {
+    batch = &b, unbounded = &u;
+    helpers.run (*this);
+  }
+};
+
+#endif
+
+void delete_elim_checkers (ElimCheckers *checkers) {
+#ifdef NTHREADS
+  assert (!checkers);
+  (void) checkers;
+#else
+  delete checkers;
+#endif
+}
+
+// Take candidates with disjoint neighborhoods from the front of the
+// schedule, check them in parallel and push them back to the schedule.
+
+void Internal::elim_check_candidates (Eliminator &eliminator, bool fast) {
+#ifdef NTHREADS
+  (void) eliminator, (void) fast;
+  assert (false);
+#else
+  ElimSchedule &schedule = eliminator.schedule;
+  const size_t threads = opts.elimthreads;
+  assert (threads > 1);
+  if (!eliminator.checkers) {
+    eliminator.checked.resize (max_var + 1, 0);
+    eliminator.touched.resize (max_var + 1, 0);
+    eliminator.unbounded.resize (max_var + 1, 0);
+    eliminator.checkers = new ElimCheckers (this, fast, threads);
+  }
+  const unsigned batch_number = ++eliminator.checking;
+  eliminator.checked_fixed = stats.all.fixed;
+  vector<int> &batch = eliminator.batch;
+  batch.clear ();
+  int64_t scanned = 0;
+  while (batch.size () < elim_batch_size && !schedule.empty ()) {
+    const int idx = schedule.front ();
+    bool disjoint = true;
+    for (int sign = -1; disjoint && sign <= 1; sign += 2)
+      for (const auto &c : occs (sign * idx)) {
+        if (c->garbage)
+          continue;
+        scanned++;
+        for (const auto &lit : *c)
+          if (eliminator.touched[abs (lit)] == batch_number)
+            disjoint = false;
+        if (!disjoint)
+          break;
+      }
+    if (!disjoint && !batch.empty ())
+      break;
+    for (int sign = -1; sign <= 1; sign += 2)
+      for (const auto &c : occs (sign * idx))
+        if (!c->garbage)
+          for (const auto &lit : *c)
+            eliminator.touched[abs (lit)] = batch_number;
+    schedule.pop_front ();
+    eliminator.checked[idx] = batch_number;
+    batch.push_back (idx);
+  }
+  stats.elimres += scanned;
+  LOG ("checking batch %u of %zu candidates", batch_number, batch.size ());
+  eliminator.checkers->check (batch, eliminator.unbounded);
+  for (const auto &idx : batch)
+    schedule.push_back (idx);
+#endif
+}
+
+// Pop the next candidate from the schedule.  With threads it is checked
+// first together with following candidates unless this already happened.
+
+int Internal::next_elim_candidate (Eliminator &eliminator, bool fast) {
+  ElimSchedule &schedule = eliminator.schedule;
+  assert (!schedule.empty ());
+#ifdef NTHREADS
+  (void) fast;
+#else
+  if (opts.elimthreads > 1) {
+    const int idx = schedule.front ();
+    if (eliminator.checked.empty () ||
+        eliminator.checked[idx] != eliminator.checking)
+      elim_check_candidates (eliminator, fast);
+    assert (schedule.front () == (unsigned) idx);
+    eliminator.checked[idx] = 0;
+  }
+#endif
+  const int idx = schedule.front ();
+  schedule.pop_front ();
+  flags (idx).elim = false;
+  return idx;
+}
+
+// Whether 'pivot' was found to have too many resolvents in parallel.
+
+bool Internal::elim_checked_unbounded (Eliminator &eliminator, int pivot) {
+  const int idx = abs (pivot);
+  if (eliminator.unbounded.empty ())
+    return false;
+  if (eliminator.checked_fixed != stats.all.fixed)
+    return false;
+  const int64_t resolutions = eliminator.unbounded[idx];
+  if (!resolutions)
+    return false;
+  LOG ("checked too many resolvents on %d in parallel", pivot);
+  eliminator.unbounded[idx] = 0;
+  stats.elimres += resolutions;
+  return true;
+}
+
+/*------------------------------------------------------------------------*/
+
 // This function performs one round of bounded variable elimination and
 // returns the number of eliminated variables. The additional result
 // 'completed' is true if this elimination round ran to completion (all
@@ -886,9 +1182,7 @@ int Internal::elim_round (bool &completed, bool &deleted_binary_clause) {
 #endif
   while (!unsat && !terminated_asynchronously () &&
          stats.elimres <= resolution_limit && !schedule.empty ()) {
-    int idx = schedule.front ();
-    schedule.pop_front ();
-    flags (idx).elim = false;
+    int idx = next_elim_candidate (eliminator, false);
     try_to_eliminate_variable (eliminator, idx, deleted_binary_clause);
 #ifndef QUIET
     tried++;
@@ -1018,6 +1312,7 @@ void Internal::elim (bool update_limits) {
     return;
   if (level)
     backtrack ();
+  clear_saved_trail ();
   if (!propagate ()) {
     learn_empty_clause ();
     return;
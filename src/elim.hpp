@@ -6,6 +6,9 @@
 namespace CaDiCaL {
 
 struct Internal;
+struct ElimCheckers;
+
+void delete_elim_checkers (ElimCheckers *);
 
 struct elim_more {
   Internal *internal;
@@ -33,7 +36,7 @@ struct Eliminator {
 
   Eliminator (Internal *i)
       : internal (i), schedule (elim_more (i)), definition_unit (0),
-        gatetype (NO) {}
+        gatetype (NO), checking (0), checked_fixed (0), checkers (0) {}
   ~Eliminator ();
 
   queue<Clause *> backward;
@@ -46,6 +49,16 @@ struct Eliminator {
   vector<proof_clause> proof_clauses;
   vector<int> marked;
   GateType gatetype;
+
+  // Candidates checked in parallel (see 'elim_check_candidates').
+  //
+  unsigned checking;         // current batch of candidates
+  int64_t checked_fixed;     // number of units when batch was checked
+  vector<unsigned> checked;  // batch in which a variable was checked
+  vector<unsigned> touched;  // batch in which a variable is a neighbor
+  vector<int64_t> unbounded; // resolutions to find too many resolvents
+  vector<int> batch;         // candidates checked in current batch
+  ElimCheckers *checkers;    // workers kept for the whole round
 };
 
 } // namespace CaDiCaL
@@ -87,6 +87,9 @@ bool Internal::elimfast_resolvents_are_bounded (Eliminator &eliminator,
     return true;
   }
 
+  if (elim_checked_unbounded (eliminator, pivot))
+    return false;
+
   // Try all resolutions between a positive occurrence (outer loop) of
   // 'pivot' and a negative occurrence of 'pivot' (inner loop) as long the
   // bound on non-tautological resolvents is not hit and the size of the
@@ -384,9 +387,7 @@ int Internal::elimfast_round (bool &completed,
 #endif
   while (!unsat && !terminated_asynchronously () &&
          stats.elimres <= resolution_limit && !schedule.empty ()) {
-    int idx = schedule.front ();
-    schedule.pop_front ();
-    flags (idx).elim = false;
+    int idx = next_elim_candidate (eliminator, true);
     try_to_fasteliminate_variable (eliminator, idx, deleted_binary_clause);
 #ifndef QUIET
     tried++;
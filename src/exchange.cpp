@@ -0,0 +1,83 @@
+#include "exchange.hpp"
+
+#include <cassert>
+#include <cstdint>
+
+namespace CaDiCaL {
+
+Exchange::Exchange () : cells (0), tail (0), head (0) {}
+
+Exchange::~Exchange () {
+  while (int *clause = pop ())
+    delete[] clause;
+  delete[] cells.load ();
+}
+
+// Several producers might race to allocate the cells.  Only one of them
+// succeeds to install its cells and the others delete theirs.
+
+Exchange::Cell *Exchange::allocate () {
+  Cell *res = new Cell[capacity];
+  for (size_t i = 0; i < capacity; i++) {
+    res[i].sequence.store (i, std::memory_order_relaxed);
+    res[i].clause = 0;
+  }
+  Cell *expected = 0;
+  if (cells.compare_exchange_strong (expected, res,
+                                     std::memory_order_acq_rel,
+                                     std::memory_order_acquire))
+    return res;
+  delete[] res;
+  return expected;
+}
+
+bool Exchange::push (const int *literals, size_t size) {
+  Cell *c = cells.load (std::memory_order_acquire);
+  if (!c)
+    c = allocate ();
+  size_t pos = tail.load (std::memory_order_relaxed);
+  Cell *cell;
+  for (;;) {
+    cell = c + (pos & (capacity - 1));
+    const size_t seq = cell->sequence.load (std::memory_order_acquire);
+    const intptr_t diff = (intptr_t) seq - (intptr_t) pos;
+    if (!diff) {
+      if (tail.compare_exchange_weak (pos, pos + 1,
+                                      std::memory_order_relaxed))
+        break;
+    } else if (diff < 0)
+      return false; // Ring full.
+    else
+      pos = tail.load (std::memory_order_relaxed);
+  }
+  int *clause = new int[size + 1];
+  clause[0] = (int) size;
+  for (size_t i = 0; i < size; i++)
+    clause[i + 1] = literals[i];
+  cell->clause = clause;
+  cell->sequence.store (pos + 1, std::memory_order_release);
+  return true;
+}
+
+bool Exchange::empty () const {
+  const Cell *c = cells.load (std::memory_order_acquire);
+  if (!c)
+    return true;
+  const Cell *cell = c + (head & (capacity - 1));
+  return cell->sequence.load (std::memory_order_acquire) != head + 1;
+}
+
+int *Exchange::pop () {
+  if (empty ())
+    return 0;
+  Cell *cell = cells.load (std::memory_order_relaxed) +
+               (head & (capacity - 1));
+  int *res = cell->clause;
+  assert (res);
+  cell->clause = 0;
+  cell->sequence.store (head + capacity, std::memory_order_release);
+  head++;
+  return res;
+}
+
+} // namespace CaDiCaL
@@ -0,0 +1,57 @@
+#ifndef _exchange_hpp_INCLUDED
+#define _exchange_hpp_INCLUDED
+
+#include <atomic>
+#include <cstddef>
+
+namespace CaDiCaL {
+
+// Lock-free bounded ring buffer of clauses to be imported into a solver
+// from other threads (see 'Solver::import_clause').  Any number of threads
+// can push clauses concurrently while only the solver itself pops them
+// (when it reaches the root-level during search, see 'import.cpp').
+
+// This follows the bounded queue of Dmitry Vyukov.  Every cell has a
+// sequence number, which tells producers and the consumer whether the cell
+// is free or filled in the current round of the ring.  Producers claim a
+// cell by incrementing 'tail' with compare-and-swap and then publish the
+// clause by updating the sequence number of the cell.  If the ring is full
+// the clause is dropped and 'push' returns false.
+
+// The clause is copied by the producer to a separately allocated array
+// holding the size followed by the literals, which the consumer owns after
+// 'pop' and has to delete.  The cells are allocated on the first 'push'
+// to avoid the memory overhead for solvers which never import clauses.
+
+class Exchange {
+
+  struct Cell {
+    std::atomic<size_t> sequence;
+    int *clause; // size followed by literals
+  };
+
+  std::atomic<Cell *> cells; // allocated on first 'push'
+  std::atomic<size_t> tail;  // next cell to fill (producers)
+  size_t head;               // next cell to pop (consumer only)
+
+  Cell *allocate ();
+
+public:
+  static const size_t capacity = (size_t) 1 << 12;
+
+  Exchange ();
+  ~Exchange ();
+
+  // Thread-safe (can be called from any thread at any time).
+  //
+  bool push (const int *literals, size_t size);
+
+  // Only the consumer (the solver thread) is allowed to call these.
+  //
+  bool empty () const;
+  int *pop ();
+};
+
+} // namespace CaDiCaL
+
+#endif
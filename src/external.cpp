@@ -7,8 +7,8 @@ namespace CaDiCaL {
 
 External::External (Internal *i)
     : internal (i), max_var (0), vsize (0), extended (false),
-      concluded (false), terminator (0), learner (0), fixed_listener (0),
-      propagator (0), solution (0), vars (max_var) {
+      concluded (false), terminator (0), learner (0), importer (0),
+      fixed_listener (0), propagator (0), solution (0), vars (max_var) {
   assert (internal);
   assert (!internal->external);
   internal->external = this;
@@ -642,10 +642,10 @@ CaDiCaL::CubesWithStatus External::generate_cubes (int depth,
     MSG ("lookahead internal %d external %d", ilit, elit);
     return elit;
   };
-  auto externalize_map = [this, externalize] (std::vector<int> cube) {
+  auto externalize_map = [this, externalize] (std::vector<int> &cube) {
     (void) this;
     MSG ("Cube : ");
-    std::for_each (begin (cube), end (cube), externalize);
+    std::transform (begin (cube), end (cube), begin (cube), externalize);
   };
   std::for_each (begin (cubes.cubes), end (cubes.cubes), externalize_map);
 
@@ -1000,7 +1000,9 @@ void External::export_learned_empty_clause () {
 
 void External::export_learned_unit_clause (int ilit) {
   assert (learner);
-  if (learner->learning (1)) {
+  if (internal->flags (ilit).imported)
+    LOG ("not exporting imported unit clause");
+  else if (learner->learning (1)) {
     LOG ("exporting learned unit clause");
     const int elit = internal->externalize (ilit);
     assert (elit);
@@ -1026,4 +1028,27 @@ void External::export_learned_large_clause (const vector<int> &clause) {
     LOG ("not exporting learned clause of size %zu", size);
 }
 
+/*------------------------------------------------------------------------*/
+
+// Map an imported external literal to an internal literal or return zero
+// if the variable is unknown, only used in extended resolution (thus has a
+// different meaning in other solvers) or has been removed internally.
+
+int External::import_literal (int elit) const {
+  assert (elit);
+  assert (elit != INT_MIN);
+  const int eidx = abs (elit);
+  if (eidx > max_var)
+    return 0;
+  if ((size_t) eidx < ervars.size () && ervars[eidx])
+    return 0;
+  int ilit = e2i[eidx];
+  if (!ilit)
+    return 0;
+  const Flags &f = internal->flags (ilit);
+  if (!f.active () && !f.fixed ())
+    return 0;
+  return elit < 0 ? -ilit : ilit;
+}
+
 } // namespace CaDiCaL
@@ -805,7 +805,7 @@ void Internal::adjust_scores_and_phases_of_fresh_variables (
   int lit = queue.first;
   queue.bumped = 0;
   while (lit) {
-    btab[lit] = ++queue.bumped;
+    links[lit].bumped = ++queue.bumped;
     lit = links[lit].next;
   }
   stats.bumped = queue.bumped;
@@ -817,7 +817,7 @@ void Internal::adjust_scores_and_phases_of_fresh_variables (
   lit = queue.first;
   int next_lit = links[lit].next;
   while (next_lit) {
-    assert (btab[lit] < btab[next_lit]);
+    assert (links[lit].bumped < links[next_lit].bumped);
     const int tmp = links[next_lit].next;
     assert (!tmp || links[tmp].prev == next_lit);
     lit = next_lit;
@@ -827,7 +827,7 @@ void Internal::adjust_scores_and_phases_of_fresh_variables (
   lit = queue.last;
   next_lit = links[lit].prev;
   while (next_lit) {
-    assert (btab[lit] > btab[next_lit]);
+    assert (links[lit].bumped > links[next_lit].bumped);
     const int tmp = links[next_lit].prev;
     assert (!tmp || links[tmp].next == next_lit);
     lit = next_lit;
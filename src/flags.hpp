@@ -9,10 +9,10 @@ struct Flags { // Variable flags.
   //
   bool seen : 1;       // seen in generating first UIP clause in 'analyze'
   bool keep : 1;       // keep in learned clause in 'minimize'
-  bool poison : 1;     // can not be removed in 'minimize'
-  bool removable : 1;  // can be removed in 'minimize'
   bool shrinkable : 1; // can be removed in 'shrink'
-  bool added : 1; // has already been added to lrat_chain (in 'minimize')
+
+  // The 'poison', 'removable' and 'added' marks of 'minimize' are not kept
+  // here but epoch stamped in 'Internal::mtab' (see 'minimize_marked').
 
   // These three variable flags are used to schedule clauses in subsumption
   // ('subsume'), variables in bounded variable elimination ('elim') and in
@@ -41,6 +41,10 @@ struct Flags { // Variable flags.
   // 2 if negated lit is in failure
   bool factored_but_on_reconstruction_stack : 1;
 
+  // Units imported from other solvers are not exported again.
+  //
+  bool imported : 1;
+
   enum {
     UNUSED = 0,
     ACTIVE = 1,
@@ -55,7 +59,7 @@ struct Flags { // Variable flags.
   // Initialized explicitly in 'Internal::init' through this function.
   //
   Flags () {
-    seen = keep = poison = removable = shrinkable = added = sweep =
+    seen = keep = shrinkable = sweep = imported =
         backbone1 = backbone0 = false;
     subsume = elim = ternary = true;
     block = 3u;
@@ -82,9 +86,8 @@ struct Flags { // Variable flags.
     dst.sweep = sweep;
     dst.backbone0 = backbone0;
     dst.backbone1 = backbone1;
-    dst.added = added;
     dst.factor = factor;
-    // seen, keep, poison, removable, shrinkable are unused
+    // seen, keep, shrinkable are unused
   }
 };
 
@@ -85,21 +85,9 @@ bool Internal::flip (int lit) {
       if (u > 0)
         continue;
 
-      const int size = w.clause->size;
-      const literal_iterator middle = lits + w.clause->pos;
-      const const_literal_iterator end = lits + size;
-      literal_iterator k = middle;
-
       int r = 0;
       signed char v = -1;
-      while (k != end && (v = val (r = *k)) < 0)
-        k++;
-      if (v < 0) {
-        k = lits + 2;
-        assert (w.clause->pos <= size);
-        while (k != middle && (v = val (r = *k)) < 0)
-          k++;
-      }
+      literal_iterator k = search_replacement (w.clause, r, v);
 
       if (v < 0) {
         res = false;
@@ -228,21 +216,9 @@ bool Internal::flippable (int lit) {
       continue;
     }
 
-    const int size = w.clause->size;
-    const literal_iterator middle = lits + w.clause->pos;
-    const const_literal_iterator end = lits + size;
-    literal_iterator k = middle;
-
     int r = 0;
     signed char v = -1;
-    while (k != end && (v = val (r = *k)) < 0)
-      k++;
-    if (v < 0) {
-      k = lits + 2;
-      assert (w.clause->pos <= size);
-      while (k != middle && (v = val (r = *k)) < 0)
-        k++;
-    }
+    literal_iterator k = search_replacement (w.clause, r, v);
 
     if (v < 0) {
       res = false;
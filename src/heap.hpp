@@ -19,13 +19,21 @@ using namespace std;
 // Since we use 'UINT_MAX' as 'not contained' flag, we can only have
 // 'UINT_MAX - 1' elements in the heap.
 
+// The heap is actually a 'd-ary' heap with 'd = 2^shift' children per node
+// and thus by default binary.  With larger arity the heap is shallower and
+// the children of a node are next to each other in 'array' (thus usually
+// on the same cache line), which for large heaps of variables in stable
+// mode reduces cache misses when bubbling up bumped variables at the cost
+// of more comparisons when bubbling down (see 'opts.scoreheap').
+
 const unsigned invalid_heap_position = UINT_MAX;
 
 template <class C> class heap {
 
-  vector<unsigned> array; // actual binary heap
+  vector<unsigned> array; // actual d-ary heap
   vector<unsigned> pos;   // positions of elements in array
   C less;                 // less-than for elements
+  unsigned shift;         // logarithm of arity 'd'
 
   // Map an element to its position entry in the 'pos' map.
   //
@@ -37,27 +45,17 @@ template <class C> class heap {
     return res;
   }
 
+  // The children of the element at position 'i' are at the positions
+  // '(i << shift) + 1' up to '(i << shift) + (1 << shift)'.
+  //
   bool has_parent (unsigned e) { return index (e) > 0; }
-  bool has_left (unsigned e) {
-    return (size_t) 2 * index (e) + 1 < size ();
-  }
-  bool has_right (unsigned e) {
-    return (size_t) 2 * index (e) + 2 < size ();
+  size_t first_child (unsigned e) {
+    return ((size_t) index (e) << shift) + 1;
   }
 
   unsigned parent (unsigned e) {
     assert (has_parent (e));
-    return array[(index (e) - 1) / 2];
-  }
-
-  unsigned left (unsigned e) {
-    assert (has_left (e));
-    return array[2 * index (e) + 1];
-  }
-
-  unsigned right (unsigned e) {
-    assert (has_right (e));
-    return array[2 * index (e) + 2];
+    return array[(index (e) - 1) >> shift];
   }
 
   // Exchange elements 'a' and 'b' in 'array' and fix their positions.
@@ -79,12 +77,14 @@ template <class C> class heap {
   // Bubble down an element as far as necessary.
   //
   void down (unsigned e) {
-    while (has_left (e)) {
-      unsigned c = left (e);
-      if (has_right (e)) {
-        unsigned r = right (e);
-        if (less (c, r))
-          c = r;
+    size_t i;
+    while ((i = first_child (e)) < size ()) {
+      const size_t end = min (i + ((size_t) 1 << shift), size ());
+      unsigned c = array[i];
+      while (++i < end) {
+        unsigned o = array[i];
+        if (less (c, o))
+          c = o;
       }
       if (!less (e, c))
         break;
@@ -102,9 +102,7 @@ template <class C> class heap {
 #warning "expensive checking in heap enabled"
     assert (array.size () <= invalid_heap_position);
     for (size_t i = 0; i < array.size (); i++) {
-      size_t l = 2*i + 1, r = 2*i + 2;
-      if (l < array.size ()) assert (!less (array[i], array[l]));
-      if (r < array.size ()) assert (!less (array[i], array[r]));
+      if (i) assert (!less (array[(i - 1) >> shift], array[i]));
       assert (array[i] >= 0);
       {
         assert ((size_t) array[i] < pos.size ());
@@ -120,7 +118,20 @@ template <class C> class heap {
   }
 
 public:
-  heap (const C &c) : less (c) {}
+  heap (const C &c) : less (c), shift (1) {}
+
+  // Change the arity of the heap to '2^new_shift' and restore the heap
+  // property by bubbling up all elements in the order of their position.
+  //
+  void reshape (unsigned new_shift) {
+    assert (new_shift);
+    if (new_shift == shift)
+      return;
+    shift = new_shift;
+    for (size_t i = 1; i < array.size (); i++)
+      up (array[i]);
+    check ();
+  }
 
   // Number of elements in the heap.
   //
@@ -0,0 +1,63 @@
+#ifndef NTHREADS
+
+#include "helpers.hpp"
+
+#include <cassert>
+
+namespace CaDiCaL {
+
+// The helpers count the jobs they worked on and wait for 'jobs' to change.
+// The last helper finishing a job wakes up the solver thread, which after
+// working on its own share waits for 'running' to drop to zero.
+
+Helpers::Helpers (size_t size)
+    : job (0), jobs (0), running (0), stopping (false) {
+  assert (size > 0);
+  for (size_t t = 1; t < size; t++)
+    threads.push_back (std::thread (&Helpers::help, this, t));
+}
+
+Helpers::~Helpers () {
+  {
+    std::lock_guard<std::mutex> guard (mutex);
+    stopping = true;
+  }
+  started.notify_all ();
+  for (auto &thread : threads)
+    thread.join ();
+}
+
+void Helpers::help (size_t t) {
+  uint64_t helped = 0;
+  std::unique_lock<std::mutex> lock (mutex);
+  for (;;) {
+    started.wait (lock, [&] { return stopping || jobs != helped; });
+    if (stopping)
+      return;
+    helped = jobs;
+    HelperJob *current = job;
+    lock.unlock ();
+    current->work (t);
+    lock.lock ();
+    if (!--running)
+      finished.notify_one ();
+  }
+}
+
+void Helpers::run (HelperJob &j) {
+  {
+    std::lock_guard<std::mutex> guard (mutex);
+    assert (!running);
+    job = &j;
+    running = threads.size ();
+    jobs++;
+  }
+  started.notify_all ();
+  j.work (0);
+  std::unique_lock<std::mutex> lock (mutex);
+  finished.wait (lock, [&] { return !running; });
+}
+
+} // namespace CaDiCaL
+
+#endif
@@ -0,0 +1,57 @@
+#ifndef _helpers_hpp_INCLUDED
+#define _helpers_hpp_INCLUDED
+
+#ifndef NTHREADS
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace CaDiCaL {
+
+// Helper threads kept for a whole inprocessing round ('subsume', 'elim',
+// 'vivify' and 'sweep') instead of starting new threads for every batch
+// of candidates.  Between batches the helpers wait on a condition variable
+// (see 'helpers.cpp').
+
+struct HelperJob {
+  virtual ~HelperJob () {}
+
+  // Called once for every thread index 't' in each 'Helpers::run', where
+  // 't = 0' is run by the calling solver thread itself.
+  //
+  virtual void work (size_t t) = 0;
+};
+
+class Helpers {
+
+  std::vector<std::thread> threads;
+
+  std::mutex mutex;
+  std::condition_variable started, finished;
+  HelperJob *job;   // current job
+  uint64_t jobs;    // number of jobs started
+  size_t running;   // helpers still working on current job
+  bool stopping;
+
+  void help (size_t t);
+
+public:
+  Helpers (size_t size); // 'size - 1' helper threads
+  ~Helpers ();
+
+  size_t size () const { return threads.size () + 1; }
+
+  // Run the job on all threads and wait until all of them are done.
+  //
+  void run (HelperJob &);
+};
+
+} // namespace CaDiCaL
+
+#endif
+
+#endif
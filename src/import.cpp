@@ -0,0 +1,167 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+// Clauses learned by other solvers working on the same formula (see the
+// portfolio mode '-j' of the stand alone solver in 'cadical.cpp') can be
+// imported through a connected 'Importer' or pushed by other threads to
+// the lock-free 'exchange' buffer (see 'Solver::import_clause').  They are
+// imported at restarts after backtracking to the root level or whenever
+// search is at the root level anyhow.  There imported clauses do not have
+// to be checked for being falsified or propagating on higher levels.
+
+// As imported clauses can not be justified in the proof nor by the
+// internal checker nothing is imported if a proof is traced.
+
+bool Internal::importing () {
+  if (proof)
+    return false;
+  if (!exchange.empty ())
+    return true;
+  if (!external->importer)
+    return false;
+  return external->importer->importing ();
+}
+
+// Polling the importer (and the exchange buffer) is not free, thus at the
+// root level outside of restarts we only poll once after new conflicts.
+
+bool Internal::importing_at_root () {
+  if (level)
+    return false;
+  if (lim.import == stats.conflicts)
+    return false;
+  lim.import = stats.conflicts;
+  return importing ();
+}
+
+// Other solvers often learn and export the same clauses.  To avoid adding
+// duplicates we keep the hashes of imported clauses in a direct mapped
+// table, where a later clause with a colliding hash simply overwrites the
+// previous entry.  A hash match is not checked further, since skipping an
+// imported clause is always sound.  The hash is computed over the external
+// literals, which in contrast to internal literals are not renumbered when
+// variables are compacted.
+
+static const size_t imported_hashes = (size_t) 1 << 14;
+
+static inline uint64_t hash_imported_literal (int elit) {
+  uint64_t res = (unsigned) elit;
+  res += 0x9e3779b97f4a7c15ull;
+  res = (res ^ (res >> 30)) * 0xbf58476d1ce4e5b9ull;
+  res = (res ^ (res >> 27)) * 0x94d049bb133111ebull;
+  return res ^ (res >> 31);
+}
+
+bool Internal::imported_before (uint64_t hash) {
+  if (imported.empty ())
+    imported.resize (imported_hashes);
+  if (!hash)
+    hash = 1;
+  uint64_t &entry = imported[hash & (imported_hashes - 1)];
+  if (entry == hash)
+    return true;
+  entry = hash;
+  return false;
+}
+
+// Literals of imported clauses which are unknown to this solver or have
+// been eliminated or substituted make the clause useless and it is skipped.
+// Otherwise the clause is simplified with respect to root-level units,
+// duplicated literals and tautologies before it is added.
+
+void Internal::import_clause (const int *literals, size_t size) {
+  assert (!level);
+  assert (clause.empty ());
+  const int *const end = literals + size;
+  uint64_t hash = 0;
+  bool skip = false;
+  for (const int *p = literals; !skip && p != end; p++) {
+    const int elit = *p;
+    const int ilit = external->import_literal (elit);
+    if (!ilit) {
+      LOG ("skipping imported clause with external literal %d", elit);
+      stats.imported.skipped++;
+      skip = true;
+      continue;
+    }
+    const signed char tmp = val (ilit);
+    if (tmp > 0) {
+      LOG ("skipping imported clause satisfied by %d", ilit);
+      stats.imported.satisfied++;
+      skip = true;
+      continue;
+    }
+    if (tmp < 0)
+      continue;
+    const signed char marking = marked (ilit);
+    if (marking > 0)
+      continue;
+    if (marking < 0) {
+      LOG ("skipping tautological imported clause with %d", ilit);
+      stats.imported.skipped++;
+      skip = true;
+      continue;
+    }
+    mark (ilit);
+    clause.push_back (ilit);
+    hash += hash_imported_literal (elit);
+  }
+  for (const auto &lit : clause)
+    unmark (lit);
+  if (skip) {
+    clause.clear ();
+    return;
+  }
+  const size_t simplified = clause.size ();
+  if (!simplified) {
+    LOG ("imported clause falsified on the root-level");
+    stats.imported.clauses++;
+    learn_empty_clause ();
+  } else if (simplified == 1) {
+    const int unit = clause[0];
+    LOG ("importing unit %d", unit);
+    stats.imported.units++;
+    flags (unit).imported = true;
+    assign_unit (unit);
+  } else if (imported_before (hash)) {
+    LOG (clause, "skipping duplicated imported");
+    stats.imported.duplicated++;
+  } else {
+    LOG (clause, "importing");
+    stats.imported.clauses++;
+    Clause *c = new_clause (true, (int) simplified);
+    watch_clause (c);
+    if (opts.binaryfirst && simplified == 2) {
+      move_last_binary_watch_forward (watches (c->literals[0]));
+      move_last_binary_watch_forward (watches (c->literals[1]));
+    }
+  }
+  clause.clear ();
+}
+
+// First drain the exchange buffer and then ask the connected importer.
+
+void Internal::import_clauses () {
+  assert (!level);
+  START (import);
+  vector<int> literals;
+  while (!unsat) {
+    if (int *exchanged = exchange.pop ()) {
+      import_clause (exchanged + 1, (size_t) exchanged[0]);
+      delete[] exchanged;
+      continue;
+    }
+    Importer *importer = external->importer;
+    if (!importer || !importer->importing ())
+      break;
+    int elit;
+    while ((elit = importer->import ()))
+      literals.push_back (elit);
+    import_clause (literals.data (), literals.size ());
+    literals.clear ();
+  }
+  STOP (import);
+}
+
+} // namespace CaDiCaL
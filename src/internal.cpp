@@ -12,26 +12,26 @@ Internal::Internal ()
       searching_lucky_phases (false), stable (false), reported (false),
       external_prop (false), did_external_prop (false),
       external_prop_is_lazy (true), forced_backt_allowed (false),
-
       private_steps (false), rephased (0), vsize (0), max_var (0),
       clause_id (0), original_id (0), reserved_ids (0), conflict_id (0),
       saved_decisions (0), concluded (false), lrat (false), frat (false),
-      level (0), vals (0), score_inc (1.0), scores (this), conflict (0),
-      ignore (0), external_reason (&external_reason_clause),
+      level (0), vals (0), vals_advised (0), score_inc (1.0), scores (this),
+      conflict (0), ignore (0), external_reason (&external_reason_clause),
       newest_clause (0), force_no_backtrack (false),
       from_propagator (false), ext_clause_forgettable (false),
       tainted_literal (0), notified (0), probe_reason (0), propagated (0),
-      propagated2 (0), propergated (0), best_assigned (0),
-      target_assigned (0), no_conflict_until (0), unsat_constraint (false),
-      marked_failed (true), sweep_incomplete (false),
-      randomized_deciding (false), citten (0), num_assigned (0), proof (0),
+      propagated2 (0), saved_head (0), saved_next (0), propergated (0),
+      best_assigned (0), target_assigned (0), no_conflict_until (0),
+      unsat_constraint (false), marked_failed (true), minimize_epoch (1),
+      sweep_incomplete (false), randomized_deciding (false), citten (0),
+      num_assigned (0), proof (0),
       opts (this),
 #ifndef QUIET
       profiles (this), force_phase_messages (false),
 #endif
-      arena (this), prefix ("c "), internal (this), external (0),
-      termination_forced (false), vars (this->max_var),
-      lits (this->max_var) {
+      arena (this), slab (this), prefix ("c "), internal (this),
+      external (0), termination_forced (false), background (0),
+      walkthread (0), vars (this->max_var), lits (this->max_var) {
   control.push_back (Level (0, 0));
 
   // The 'dummy_binary' is used in 'try_to_subsume_clause' to fake a real
@@ -55,6 +55,8 @@ Internal::Internal ()
 }
 
 Internal::~Internal () {
+  stop_background ();
+  stop_walkthread ();
   // If a memory exception ocurred a profile might still be active.
 #ifndef QUIET
 #define PROFILE(NAME, LEVEL) \
@@ -76,7 +78,7 @@ Internal::~Internal () {
     delete stattracer;
   if (vals) {
     vals -= vsize;
-    delete[] vals;
+    deallocate_memory ((char *) vals);
   }
 }
 
@@ -98,12 +100,16 @@ Internal::~Internal () {
 // by static analyzers though.  Clang with '--analyze' thought that this
 // idiom would generate a memory leak thus we use the following dummy.
 
+// The additional padding bytes at the end allow to read a full word
+// starting at 'vals[max_var]' (see 'find_non_false_literal').
+
 static signed char *ignore_clang_analyze_memory_leak_warning;
 
 void Internal::enlarge_vals (size_t new_vsize) {
   signed char *new_vals;
-  const size_t bytes = 2u * new_vsize;
-  new_vals = new signed char[bytes]; // g++-4.8 does not like ... { 0 };
+  const size_t bytes = 2u * new_vsize + sizeof (int) - 1;
+  new_vals = (signed char *) allocate_memory (bytes, opts.hugepages,
+                                              vals_advised);
   memset (new_vals, 0, bytes);
   ignore_clang_analyze_memory_leak_warning = new_vals;
   new_vals += new_vsize;
@@ -111,7 +117,7 @@ void Internal::enlarge_vals (size_t new_vsize) {
   if (vals) {
     memcpy (new_vals - max_var, vals - max_var, 2u * max_var + 1u);
     vals -= vsize;
-    delete[] vals;
+    deallocate_memory ((char *) vals);
   } else
     assert (!vsize);
   vals = new_vals;
@@ -133,8 +139,8 @@ void Internal::enlarge (int new_max_var) {
   enlarge_only (vtab, new_vsize);
   enlarge_zero (parents, new_vsize);
   enlarge_only (links, new_vsize);
-  enlarge_zero (btab, new_vsize);
   enlarge_zero (gtab, new_vsize);
+  enlarge_zero (mtab, new_vsize);
   enlarge_zero (stab, new_vsize);
   enlarge_init (ptab, 2 * new_vsize, -1);
   enlarge_only (ftab, new_vsize);
@@ -164,12 +170,12 @@ void Internal::init_vars (int new_max_var) {
   for (int64_t i = -new_max_var; i < -max_var; i++)
     assert (!vals[i]);
   for (unsigned i = max_var + 1; i <= (unsigned) new_max_var; i++)
-    assert (!vals[i]), assert (!btab[i]), assert (!gtab[i]);
+    assert (!vals[i]), assert (!links[i].bumped), assert (!gtab[i]);
   for (uint64_t i = 2 * ((uint64_t) max_var + 1);
        i <= 2 * (uint64_t) new_max_var + 1; i++)
     assert (ptab[i] == -1);
 #endif
-  assert (!btab[0]);
+  assert (!links[0].bumped);
   int old_max_var = max_var;
   max_var = new_max_var;
   init_queue (old_max_var, new_max_var);
@@ -313,6 +319,8 @@ int Internal::cdcl_loop_with_inprocessing () {
       break;                               // decision or conflict limit
     else if (terminated_asynchronously ()) // externally terminated
       break;
+    else if (importing_at_root ())
+      import_clauses (); // import at root-level
     else if (restarting ())
       restart (); // restart by backtracking
     else if (rephasing ())
@@ -949,6 +957,7 @@ int Internal::solve (bool preprocess_only) {
   assert (clause.empty ());
   stats.searches++;
   START (solve);
+  clear_saved_trail ();
   if (proof)
     proof->solve_query ();
   if (opts.ilb) {
@@ -969,6 +978,7 @@ int Internal::solve (bool preprocess_only) {
   else
     LOG ("internal solving in full mode");
   init_report_limits ();
+  scores.reshape (opts.scoreheap);
   int res = already_solved ();
   if (!res && preprocess_only && level)
     backtrack ();
@@ -998,6 +1008,8 @@ int Internal::solve (bool preprocess_only) {
       res = cdcl_loop_with_inprocessing ();
     }
   }
+  stop_background ();
+  stop_walkthread ();
   finalize (res);
   reset_solving ();
   report_solving (res);
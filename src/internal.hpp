@@ -49,6 +49,7 @@ extern "C" {
 
 #include "arena.hpp"
 #include "averages.hpp"
+#include "background.hpp"
 #include "bins.hpp"
 #include "block.hpp"
 #include "cadical.hpp"
@@ -62,6 +63,7 @@ extern "C" {
 #include "drattracer.hpp"
 #include "elim.hpp"
 #include "ema.hpp"
+#include "exchange.hpp"
 #include "external.hpp"
 #include "factor.hpp"
 #include "file.hpp"
@@ -69,6 +71,7 @@ extern "C" {
 #include "format.hpp"
 #include "frattracer.hpp"
 #include "heap.hpp"
+#include "helpers.hpp"
 #include "idruptracer.hpp"
 #include "instantiate.hpp"
 #include "internal.hpp"
@@ -93,6 +96,7 @@ extern "C" {
 #include "reluctant.hpp"
 #include "resources.hpp"
 #include "score.hpp"
+#include "slab.hpp"
 #include "stats.hpp"
 #include "sweep.hpp"
 #include "terminal.hpp"
@@ -103,6 +107,7 @@ extern "C" {
 #include "version.hpp"
 #include "vivify.hpp"
 #include "walk.hpp"
+#include "walkthread.hpp"
 #include "watch.hpp"
 
 // c headers
@@ -119,6 +124,8 @@ struct Coveror;
 struct External;
 struct WalkerFO;
 struct Walker;
+struct Background;
+struct WalkThread;
 class Tracer;
 class FileTracer;
 class StatTracer;
@@ -217,6 +224,7 @@ struct Internal {
   int level;                    // decision level ('control.size () - 1')
   Phases phases;                // saved, target and best phases
   signed char *vals;            // assignment [-max_var,max_var]
+  size_t vals_advised;          // bytes of 'vals' advised huge pages
   vector<signed char> marks;    // signed marks [1,max_var]
   vector<unsigned> frozentab;   // frozen counters [1,max_var]
   vector<int> i2e;              // maps internal 'idx' to external 'lit'
@@ -229,8 +237,8 @@ struct Internal {
   vector<Var> vtab;             // variable table [1,max_var]
   vector<int> parents;          // parent literals during probing
   vector<Flags> ftab;           // variable and literal flags
-  vector<int64_t> btab;         // enqueue time stamps for queue
   vector<int64_t> gtab;         // time stamp table to recompute glue
+  vector<uint64_t> mtab;        // epoch stamped minimization marks
   vector<Occs> otab;            // table of occurrences for all literals
   vector<Occs> rtab;            // table of redundant occurrences
   vector<int> ptab;             // table for caching probing attempts
@@ -250,6 +258,10 @@ struct Internal {
   Clause *probe_reason;      // set during probing
   size_t propagated;         // next trail position to propagate
   size_t propagated2;        // next binary trail position to propagate
+  vector<int> saved_trail;   // literals unassigned in last back-jump
+  vector<Clause *> saved_reasons; // and their reasons (zero = decision)
+  size_t saved_head;         // next saved literal to match
+  int saved_next;            // 'saved_trail[saved_head]' or zero
   size_t propergated;        // propagated without blocking literals
   size_t best_assigned;      // best maximum assigned ever
   size_t target_assigned;    // maximum assigned without conflict
@@ -261,11 +273,12 @@ struct Internal {
   bool unsat_constraint;     // constraint used for unsatisfiability?
   bool marked_failed;        // are the failed assumptions marked?
   vector<int> original;      // original added literals
+  vector<uint64_t> imported; // hashes of recently imported clauses
   vector<int> levels;        // decision levels in learned clause
   vector<int> analyzed;      // analyzed literals in 'analyze'
   vector<int> unit_analyzed; // to avoid duplicate units in lrat_chain
   vector<int> sign_marked;   // literals skipped in 'decompose'
-  vector<int> minimized;     // removable or poison in 'minimize'
+  uint64_t minimize_epoch;   // valid epoch of marks in 'mtab'
   vector<int> shrinkable;    // removable or poison in 'shrink'
   Reap reap;                 // radix heap for shrink
 
@@ -304,6 +317,8 @@ struct Internal {
   bool force_phase_messages; // force 'phase (...)' messages
 #endif
   Arena arena;          // memory arena for moving garbage collector
+  Slab slab;            // slab allocator for new small clauses
+  Exchange exchange;    // clauses pushed by other threads to be imported
   Format error_message; // provide persistent error message
   string prefix;        // verbose messages prefix
 
@@ -319,6 +334,14 @@ struct Internal {
   //
   volatile bool termination_forced;
 
+  // Helper simplifying a snapshot of the formula in a separate thread.
+  //
+  Background *background;
+
+  // Helper running local search on a snapshot of the formula.
+  //
+  WalkThread *walkthread;
+
   /*----------------------------------------------------------------------*/
 
   const Range vars; // Provides safe variable iteration.
@@ -452,12 +475,35 @@ struct Internal {
   Var &var (int lit) { return vtab[vidx (lit)]; }
   Link &link (int lit) { return links[vidx (lit)]; }
   Flags &flags (int lit) { return ftab[vidx (lit)]; }
-  int64_t &bumped (int lit) { return btab[vidx (lit)]; }
+  int64_t &bumped (int lit) { return links[vidx (lit)].bumped; }
   int &propfixed (int lit) { return ptab[vlit (lit)]; }
   double &score (int lit) { return stab[vidx (lit)]; }
 
   const Flags &flags (int lit) const { return ftab[vidx (lit)]; }
 
+  // The 'poison', 'removable' and 'added' marks of 'minimize' and 'shrink'
+  // are kept in 'mtab' together with the epoch in which they were set.  A
+  // mark of an earlier epoch counts as cleared, so 'clear_minimized_literals'
+  // only needs to start a new epoch instead of walking all marked literals.
+  //
+  enum { POISON = 1, REMOVABLE = 2, ADDED = 4 };
+
+  bool minimize_marked (int lit, unsigned mark) const {
+    const uint64_t stamp = mtab[vidx (lit)];
+    return (stamp >> 3) == minimize_epoch && (stamp & mark);
+  }
+  void minimize_mark (int lit, unsigned mark) {
+    uint64_t &stamp = mtab[vidx (lit)];
+    if ((stamp >> 3) != minimize_epoch)
+      stamp = minimize_epoch << 3;
+    stamp |= mark;
+  }
+  void minimize_unmark (int lit, unsigned mark) {
+    uint64_t &stamp = mtab[vidx (lit)];
+    if ((stamp >> 3) == minimize_epoch)
+      stamp &= ~(uint64_t) mark;
+  }
+
   bool occurring () const { return !otab.empty (); }
   bool watching () const { return !wtab.empty (); }
 
@@ -638,6 +684,34 @@ struct Internal {
     LOG (c, "watch binary %d blit %d in", lit, blit);
   }
 
+  // Search for a replacement watch 'r' with value 'v' in a long clause
+  // starting at the saved position 'pos' [Gent'13] until the end of the
+  // clause and then if that failed, starting at the first non-watched
+  // literal until the saved position.  The result is the position of the
+  // replacement, or the saved position if all literals are falsified, in
+  // which case 'v' is negative.  Inlined here since it is shared by all
+  // the propagation loops.
+  //
+  inline literal_iterator search_replacement (Clause *c, int &r,
+                                              signed char &v) {
+    const literal_iterator lits = c->begin ();
+    const const_literal_iterator end = lits + c->size;
+    const literal_iterator middle = lits + c->pos;
+    assert (lits + 2 <= middle);
+    assert (middle <= end);
+    literal_iterator k = find_non_false_literal (vals, middle, end);
+    if (k == end) {
+      k = find_non_false_literal (vals, lits + 2, middle);
+      if (k == middle) {
+        v = -1;
+        return k;
+      }
+    }
+    v = val (r = *k);
+    assert (v >= 0);
+    return k;
+  }
+
   // Add two watches to a clause.  This is used initially during allocation
   // of a clause and during connecting back all watches after preprocessing.
   //
@@ -664,11 +738,12 @@ struct Internal {
     assert (0 < idx);
     assert (idx <= max_var);
     queue.unassigned = idx;
-    queue.bumped = btab[idx];
-    LOG ("queue unassigned now %d bumped %" PRId64 "", idx, btab[idx]);
+    queue.bumped = links[idx].bumped;
+    LOG ("queue unassigned now %d bumped %" PRId64 "", idx,
+         links[idx].bumped);
   }
 
-  void bump_queue (int idx);
+  void bump_queue_batch ();
 
   // Mark (active) variables as eliminated, substituted, pure or fixed,
   // which turns them into inactive variables.
@@ -689,12 +764,12 @@ struct Internal {
   void minimize_sort_clause ();
   void shrink_and_minimize_clause ();
   void reset_shrinkable ();
-  void mark_shrinkable_as_removable (int, std::vector<int>::size_type);
+  void mark_shrinkable_as_removable ();
   int shrink_literal (int, int, unsigned);
   unsigned shrunken_block_uip (int, int,
                                std::vector<int>::reverse_iterator &,
                                std::vector<int>::reverse_iterator &,
-                               std::vector<int>::size_type, const int);
+                               const int);
   void shrunken_block_no_uip (const std::vector<int>::reverse_iterator &,
                               const std::vector<int>::reverse_iterator &,
                               unsigned &, const int);
@@ -710,6 +785,7 @@ struct Internal {
                          unsigned &, unsigned &, const int, unsigned);
   unsigned shrink_along_reason (int, int, bool, bool &, unsigned);
 
+  Clause *allocate_clause (size_t bytes);
   void deallocate_clause (Clause *);
   void delete_clause (Clause *);
   void mark_garbage (Clause *);
@@ -725,6 +801,7 @@ struct Internal {
   int assignment_level (int lit, Clause *);
   void build_chain_for_units (int lit, Clause *reason, bool forced);
   void build_chain_for_empty ();
+  template <bool chrono_mode> void search_assign (int lit, Clause *);
   void search_assign (int lit, Clause *);
   void search_assign_driving (int lit, Clause *reason);
   void search_assign_external (int lit);
@@ -735,6 +812,11 @@ struct Internal {
   int64_t cache_lines (size_t n, size_t bytes) {
     return cache_lines (n * bytes);
   }
+  template <bool lrat_mode, bool chrono_mode>
+  void search_propagate2 (int64_t &ticks);
+  template <bool lrat_mode, bool chrono_mode>
+  void propagate_literals (int64_t &ticks, int64_t &prefetches,
+                           int64_t &stalls);
   bool propagate ();
 
 #ifdef PROFILE_MODE
@@ -759,8 +841,11 @@ struct Internal {
   //
   void unassign (int lit);
   void update_target_and_best ();
-  void backtrack (int target_level = 0);
-  void backtrack_without_updating_phases (int target_level = 0);
+  void backtrack (int target_level = 0, bool save_trail = false);
+  void backtrack_without_updating_phases (int target_level = 0,
+                                          bool save_trail = false);
+  void clear_saved_trail ();
+  void replay_saved_trail ();
 
   // Minimized learned clauses in 'minimize.cpp'.
   //
@@ -773,7 +858,6 @@ struct Internal {
   void learn_empty_clause ();
   void learn_unit_clause (int lit);
 
-  void bump_variable (int lit);
   void bump_variables ();
   int recompute_glue (Clause *);
   void bump_clause (Clause *);
@@ -860,6 +944,28 @@ struct Internal {
   int reuse_trail ();
   void restart ();
 
+  // Importing clauses from other solvers in 'import.cpp'.
+  //
+  bool importing ();
+  bool importing_at_root ();
+  bool imported_before (uint64_t hash);
+  void import_clause (const int *literals, size_t size);
+  void import_clauses ();
+
+  // Simplification in a helper thread in 'background.cpp'.
+  //
+  bool backgrounding ();
+  void start_background ();
+  void stop_background ();
+  void collect_background ();
+
+  // Local search in a helper thread in 'walkthread.cpp'.
+  //
+  bool walkthreading ();
+  void start_walkthread ();
+  bool import_walkthread ();
+  void stop_walkthread ();
+
   // Functions to set and reset certain 'phases'.
   //
   void clear_phases (vector<signed char> &); // reset argument to zero
@@ -929,6 +1035,8 @@ struct Internal {
   size_t flush_occs (int lit);
   void flush_all_occs_and_watches ();
   void update_reason_references ();
+  size_t select_evacuated_regions ();
+  inline bool moving (Clause *);
   void copy_non_garbage_clauses ();
   void delete_garbage_clauses ();
   void check_clause_stats ();
@@ -965,6 +1073,8 @@ struct Internal {
   void subsume_clause (Clause *subsuming, Clause *subsumed);
   int subsume_check (Clause *subsuming, Clause *subsumed);
   int try_to_subsume_clause (Clause *, vector<Clause *> &shrunken);
+  int subsume_or_strengthen_clause (Clause *, Clause *, int flipped,
+                                    vector<Clause *> &shrunken);
   void reset_subsume_bits ();
   bool subsume_round ();
   void subsume ();
@@ -1244,6 +1354,9 @@ struct Internal {
   void elim_propagate (Eliminator &, int unit);
   void elim_on_the_fly_self_subsumption (Eliminator &, Clause *, int);
   void try_to_eliminate_variable (Eliminator &, int pivot, bool &);
+  void elim_check_candidates (Eliminator &, bool fast);
+  int next_elim_candidate (Eliminator &, bool fast);
+  bool elim_checked_unbounded (Eliminator &, int pivot);
   void increase_elimination_bound ();
   int elim_round (bool &completed, bool &);
   void elim (bool update_limits = true);
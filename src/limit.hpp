@@ -18,16 +18,19 @@ struct Limit {
   int64_t localsearch;   // limit on local search rounds
   int64_t ticks;         // ticks limit if non-negative
 
+  int64_t background;        // conflict limit for next 'background'
   int64_t compact;           // conflict limit for next 'compact'
   int64_t condition;         // conflict limit for next 'condition'
   int64_t elim;              // conflict limit for next 'elim'
   int64_t flush;             // conflict limit for next 'flush'
+  int64_t import;            // conflicts at last root-level 'import'
   int64_t inprobe;           // conflict limit for next 'inprobe'
   int64_t reduce;            // conflict limit for next 'reduce'
   int64_t rephase;           // conflict limit for next 'rephase'
   int64_t report;            // report limit for header
   int64_t restart;           // conflict limit for next 'restart'
   int64_t stabilize;         // conflict/ticks limit for next 'stabilize'
+  int64_t walkthread;        // conflict limit for next 'walkthread'
   int64_t incremental_decay; // conflict/ticks limit for next clause 'decay'
                              // for incremental clauses
   int64_t random_decision;   // randomized decision limit for conflicts
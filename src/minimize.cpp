@@ -19,9 +19,9 @@ bool Internal::minimize_literal (int lit, int depth) {
   assert (val (lit) > 0);
   Flags &f = flags (lit);
   Var &v = var (lit);
-  if (!v.level || f.removable || f.keep)
+  if (!v.level || f.keep || minimize_marked (lit, REMOVABLE))
     return true;
-  if (!v.reason || f.poison || v.level == level)
+  if (!v.reason || v.level == level || minimize_marked (lit, POISON))
     return false;
   const Level &l = control[v.level];
   if (!depth && l.seen.count < 2)
@@ -51,11 +51,7 @@ bool Internal::minimize_literal (int lit, int depth) {
       continue;
     res = minimize_literal (-other, depth + 1);
   }
-  if (res)
-    f.removable = true;
-  else
-    f.poison = true;
-  minimized.push_back (lit);
+  minimize_mark (lit, res ? REMOVABLE : POISON);
   if (!depth) {
     LOG ("minimizing %d %s", lit, res ? "succeeded" : "failed");
   }
@@ -114,7 +110,6 @@ void Internal::minimize_clause () {
   external->check_learned_clause (); // check 1st UIP learned clause first
   minimize_sort_clause ();
 
-  assert (minimized.empty ());
   assert (minimize_chain.empty ());
   const auto end = clause.end ();
   auto j = clause.begin (), i = j;
@@ -168,7 +163,7 @@ void Internal::calculate_minimize_chain (int lit, std::vector<int> &stack) {
     assert (idx);
     Flags &f = flags (idx);
     Var &v = var (idx);
-    if (f.keep || f.added || f.poison) {
+    if (f.keep || minimize_marked (idx, ADDED | POISON)) {
       continue;
     }
     if (!v.level) {
@@ -181,8 +176,8 @@ void Internal::calculate_minimize_chain (int lit, std::vector<int> &stack) {
       unit_chain.push_back (id);
       continue;
     }
-    f.added = true;
-    assert (v.reason && f.removable);
+    assert (v.reason && minimize_marked (idx, REMOVABLE));
+    minimize_mark (idx, ADDED);
     const const_literal_iterator end = v.reason->end ();
     const_literal_iterator i;
     LOG (v.reason, "LRAT chain for lit %d at depth %zd by going over", lit,
@@ -208,17 +203,17 @@ void Internal::minimize_sort_clause () {
          minimize_trail_smaller (this));
 }
 
+// Clearing all 'poison' and 'removable' marks after every conflict would
+// require to walk all literals visited during minimization, which for long
+// learned clauses are many more than the literals kept in the clause.
+// Instead we only start a new epoch which invalidates all the marks.  Only
+// the 'keep' flags of the literals in the learned clause are still reset.
+
 void Internal::clear_minimized_literals () {
-  LOG ("clearing %zd minimized literals", minimized.size ());
-  for (const auto &lit : minimized) {
-    Flags &f = flags (lit);
-    f.poison = f.removable = f.shrinkable = f.added = false;
-  }
+  LOG ("clearing minimized literals of epoch %" PRIu64, minimize_epoch);
+  minimize_epoch++;
   for (const auto &lit : clause)
-    assert (!flags (lit).shrinkable), flags (lit).keep =
-                                          flags (lit).shrinkable =
-                                              flags (lit).added = false;
-  minimized.clear ();
+    assert (!flags (lit).shrinkable), flags (lit).keep = false;
 }
 
 } // namespace CaDiCaL
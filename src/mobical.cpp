@@ -2443,6 +2443,10 @@ bool Trace::ignored_option (const char *name) {
     return true;
   if (!strcmp (name, "terminateint"))
     return true;
+  if (!strcmp (name, "background"))
+    return true; // Depends on thread timing.
+  if (!strcmp (name, "walkthread"))
+    return true; // Depends on thread timing.
 
   return false;
 }
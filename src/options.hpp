@@ -23,6 +23,7 @@
 \
 OPTION( arena,             1,  0,  1,0,0,1, "allocate clauses in arena") \
 OPTION( arenacompact,      1,  0,  1,0,0,1, "keep clauses compact") \
+OPTION( arenaslice,        0,  0,1e5,0,0,1, "max MB moved per collection (0=all)") \
 OPTION( arenasort,         1,  0,  1,0,0,1, "sort clauses in arena") \
 OPTION( arenatype,         3,  1,  3,0,0,1, "1=clause, 2=var, 3=queue") \
 OPTION( backbone,          1,  0,  2,0,0,1, "binary clause backbone") \
@@ -30,7 +31,11 @@ OPTION( backboneeffort,   20,  0,1e5,0,0,1, "binary effort in per mile") \
 OPTION( backbonemaxrounds,1e3, 0,1e5,0,0,1, "backbone rounds limit") \
 OPTION( backbonerounds,  100,  0,1e5,0,0,1, "backbone rounds limit") \
 OPTION( backbonethresh,    5,  0,1e9,1,0,1, "delay if ticks smaller thresh*clauses") \
+OPTION( background,        0,  0,  1,0,1,1, "simplify snapshot in helper thread") \
+OPTION( backgroundint,   1e4,  1,2e9,0,0,1, "background interval in conflicts") \
+OPTION( backgroundrounds,  2,  1, 16,0,0,1, "background simplification rounds") \
 OPTION( binary,            1,  0,  1,0,0,1, "use binary proof format") \
+OPTION( binaryfirst,       0,  0,  1,0,0,1, "propagate binary clauses first") \
 OPTION( block,             0,  0,  1,0,1,1, "blocked clause elimination") \
 OPTION( blockmaxclslim,  1e5,  1,2e9,2,0,1, "maximum clause size") \
 OPTION( blockminclslim,    2,  2,2e9,0,0,1, "minimum clause size") \
@@ -101,6 +106,7 @@ OPTION( elimprod,          1,  0,1e4,0,0,1, "elim score product weight") \
 OPTION( elimrounds,        2,  1,512,1,0,1, "usual number of rounds") \
 OPTION( elimsubst,         1,  0,  1,0,0,1, "elimination by substitution") \
 OPTION( elimsum,           1,  0,1e4,0,0,1, "elimination score sum weight") \
+OPTION( elimthreads,       1,  1, 64,0,0,1, "resolvent checking threads") \
 OPTION( elimxorlim,        5,  2, 27,1,0,1, "maximum XOR size") \
 OPTION( elimxors,          1,  0,  1,0,0,1, "find XOR gates") \
 OPTION( emadecisions,    1e5,  1,2e9,0,0,1, "window decision rate") \
@@ -132,6 +138,7 @@ OPTION( flushfactor,       3,  1,1e3,0,0,1, "interval increase") \
 OPTION( flushint,        1e5,  1,2e9,0,0,1, "initial limit") \
 OPTION( forcephase,        0,  0,  1,0,0,1, "always use initial phase") \
 OPTION( frat,              0,  0,  2,0,0,1, "1=frat(lrat), 2=frat(drat)") \
+OPTION( hugepages,         0,  0,  1,0,0,1, "huge pages for arena and values") \
 OPTION( idrup,             0,  0,  1,0,0,1, "incremental proof format") \
 OPTION( ilb,               0,  0,  2,0,0,1, "ILB (incremental lazy backtrack) (0: no, 1: assumptions only, 2: everything)") \
 OPTION( incdecay,          1,  0,  4,0,0,1, "decay clauses when doing incremental clauses" ) \
@@ -156,6 +163,7 @@ OPTION( minimizedepth,   1e3,  0,1e3,0,0,1, "minimization depth") \
 OPTION( minimizeticks,     1,  0,  1,0,0,1, "increment ticks in minimization") \
 OPTION( otfs,              1,  0,  1,0,0,1, "on-the-fly self subsumption") \
 OPTION( phase,             1,  0,  1,0,0,1, "initial phase") \
+OPTION( prefetch,          0,  0, 64,0,0,1, "clause prefetch distance (0=disabled)") \
 OPTION( preprocessinit,  2e6,  0,2e9,2,0,1, "initial preprocessing base limit" ) \
 OPTION( preprocesslight,   1,  0,  1,0,1,1, "lightweight preprocessing" ) \
 OPTION( probe,             1,  0,  1,0,1,1, "failed literal probing" ) \
@@ -198,6 +206,7 @@ OPTION( restoreflush,      0,  0,  1,0,0,1, "remove satisfied clauses") \
 OPTION( reverse,           0,  0,  1,0,0,1, "reverse variable ordering") \
 OPTION( score,             1,  0,  1,0,0,1, "use EVSIDS scores") \
 OPTION( scorefactor,     950,500,1e3,0,0,1, "score factor per mille") \
+OPTION( scoreheap,         1,  1,  3,0,0,1, "log2 of score heap arity") \
 OPTION( seed,              0,  0,2e9,0,0,1, "random seed") \
 OPTION( shrink,            3,  0,  3,0,0,1, "shrink conflict clause (1=binary-only,2=minimize-on-pulling,3=full)") \
 OPTION( shrinkreap,        1,  0,  1,0,0,1, "use a reap for shrinking") \
@@ -205,6 +214,7 @@ OPTION( shuffle,           0,  0,  1,0,0,1, "shuffle variables") \
 OPTION( shufflequeue,      1,  0,  1,0,0,1, "shuffle variable queue") \
 OPTION( shufflerandom,     0,  0,  1,0,0,1, "not reverse but random") \
 OPTION( shufflescores,     1,  0,  1,0,0,1, "shuffle variable scores") \
+OPTION( slab,              0,  0,  1,0,0,1, "slab allocation of small new clauses") \
 OPTION( stabilize,         1,  0,  1,0,0,1, "enable stabilizing phases") \
 OPTION( stabilizeinit,   1e3,  1,2e9,0,0,1, "stabilizing interval") \
 OPTION( stabilizeonly,     0,  0,  1,0,0,1, "only stabilizing phases") \
@@ -219,6 +229,7 @@ OPTION( subsumemaxeff,   1e8,  0,2e9,1,0,1, "maximum subsuming efficiency") \
 OPTION( subsumemineff,     0,  0,2e9,1,0,1, "minimum subsuming efficiency") \
 OPTION( subsumeocclim,   1e2,  0,2e9,1,0,1, "watch list length limit") \
 OPTION( subsumestr,        1,  0,  1,0,0,1, "subsume strengthen") \
+OPTION( subsumethreads,    1,  1, 64,0,0,1, "subsumption checking threads") \
 OPTION( sweep,             1,  0,  1,0,1,1, "enable SAT sweeping") \
 OPTION( sweepclauses,   1024,  0,2e9,1,0,1, "environment clauses") \
 OPTION( sweepcomplete,     0,  0,  1,0,0,1, "run SAT sweeping to completion") \
@@ -230,6 +241,7 @@ OPTION( sweepmaxclauses, 3e5,  2,2e9,1,0,1, "maximum environment clauses") \
 OPTION( sweepmaxdepth,     3,  1,2e9,1,0,1, "maximum environment depth") \
 OPTION( sweepmaxvars,   8192,  2,2e9,1,0,1, "maximum environment variables") \
 OPTION( sweeprand,         0,  0,  1,0,0,1, "randomize sweeping environment") \
+OPTION( sweepthreads,      1,  1, 64,0,0,1, "sweeping threads") \
 OPTION( sweepthresh,       5,  0,100,1,0,1, "delay if ticks smaller thresh*clauses") \
 OPTION( sweepvars,       256,  0,2e9,1,0,1, "environment variables") \
 OPTION( target,            1,  0,  2,0,0,1, "target phases (1=stable only)") \
@@ -244,6 +256,7 @@ OPTION( tier1limit,       50,  0,100,0,0,1, "limit of tier1 usage in percentage"
 OPTION( tier1minglue,      0,  0,100,0,0,1, "lowest tier1 limit") \
 OPTION( tier2limit,       90,  0,100,0,0,1, "limit of tier2 usage in percentage") \
 OPTION( tier2minglue,      0,  0,100,0,0,1, "lowest tier2 limit") \
+OPTION( trailsave,         0,  0,  1,0,0,1, "save and replay trail after back-jumps") \
 OPTION( transred,          1,  0,  1,0,1,1, "transitive reduction of BIG") \
 OPTION( transredeffort,  1e2,  1,1e5,1,0,1, "relative efficiency per mille") \
 OPTION( transredmaxeff,  1e8,  0,2e9,1,0,1, "maximum efficiency") \
@@ -261,6 +274,7 @@ OPTION( vivifyirredeff,    3,  1,100,1,0,1, "irredundant efficiency per mille")
 OPTION( vivifyonce,        0,  0,  2,0,0,1, "vivify once: 1=red, 2=red+irr") \
 OPTION( vivifyretry,       0,  0,  5,0,0,1, "re-vivify clause if vivify was successful") \
 OPTION( vivifyschedmax,  5e3, 10,2e9,0,0,1, "maximum schedule size") \
+OPTION( vivifythreads,     1,  1, 64,0,0,1, "vivification probing threads") \
 OPTION( vivifythresh,     20,  0,100,1,0,1, "delay if ticks smaller thresh*clauses") \
 OPTION( vivifytier1,       1,  0,  1,0,0,1, "vivification tier1") \
 OPTION( vivifytier1eff,    4,  0,100,1,0,1, "relative tier1 effort") \
@@ -275,6 +289,8 @@ OPTION( walkmaxeff,      1e7,  0,2e9,1,0,1, "maximum efficiency (in 1e3 ticks)")
 OPTION( walkmineff,        0,  0,1e7,1,0,1, "minimum efficiency") \
 OPTION( walknonstable,     1,  0,  1,0,0,1, "walk in non-stabilizing phase") \
 OPTION( walkredundant,     0,  0,  1,0,0,1, "walk redundant clauses too") \
+OPTION( walkthread,        0,  0,  1,0,0,1, "local search in helper thread") \
+OPTION( walkthreadint,   1e4,  1,2e9,0,0,1, "walk thread interval in conflicts") \
 OPTION( warmup,            1,  0,  1,0,0,1, "warmup before walk using propagation") \
 
 // Note, keep an empty line right before this line because of the last '\'!
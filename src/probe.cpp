@@ -442,20 +442,9 @@ bool Internal::probe_propagate () {
         if (u > 0)
           ws[j - 1].blit = other;
         else {
-          const int size = w.clause->size;
-          const const_literal_iterator end = lits + size;
-          const literal_iterator middle = lits + w.clause->pos;
-          literal_iterator k = middle;
           int r = 0;
           signed char v = -1;
-          while (k != end && (v = val (r = *k)) < 0)
-            k++;
-          if (v < 0) {
-            k = lits + 2;
-            assert (w.clause->pos <= size);
-            while (k != middle && (v = val (r = *k)) < 0)
-              k++;
-          }
+          literal_iterator k = search_replacement (w.clause, r, v);
           w.clause->pos = k - lits;
           assert (lits + 2 <= k), assert (k <= w.clause->end ());
           if (v > 0)
@@ -917,6 +906,7 @@ void CaDiCaL::Internal::inprobe (bool update_limits) {
     return;
   if (level)
     backtrack ();
+  clear_saved_trail ();
   if (!propagate ()) {
     learn_empty_clause ();
     return;
@@ -48,6 +48,7 @@ struct Internal;
   MROFILE (analyzestable, 4) \
   MROFILE (analyzeunstable, 4) \
   PROFILE (backbone, 2) \
+  PROFILE (background, 3) \
   PROFILE (backward, 3) \
   PROFILE (block, 2) \
   PROFILE (bump, 4) \
@@ -74,6 +75,7 @@ struct Internal;
   PROFILE (extractbinaries, 4) \
   PROFILE (extractites, 4) \
   PROFILE (extractxors, 4) \
+  PROFILE (import, 3) \
   PROFILE (instantiate, 2) \
   PROFILE (lucky, 2) \
   PROFILE (lookahead, 2) \
@@ -110,6 +112,7 @@ struct Internal;
   PROFILE (walkflip, 3) \
   PROFILE (walkflipbroken, 4) \
   PROFILE (walkflipWL, 4) \
+  PROFILE (walkthread, 3) \
   PROFILE (warmup, 3)
 
 /*------------------------------------------------------------------------*/
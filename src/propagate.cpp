@@ -99,8 +99,14 @@ void Internal::build_chain_for_empty () {
 
 /*------------------------------------------------------------------------*/
 
+// The template parameter 'chrono_mode' has to match 'opts.chrono' and
+// avoids checking that option for every assignment in 'propagate'.
+
+template <bool chrono_mode>
 inline void Internal::search_assign (int lit, Clause *reason) {
 
+  assert (chrono_mode == (opts.chrono > 0));
+
   if (level)
     require_mode (SEARCH);
 
@@ -127,7 +133,7 @@ inline void Internal::search_assign (int lit, Clause *reason) {
     lit_level = 0; // unit
   else if (reason == decision_reason)
     lit_level = level, reason = 0;
-  else if (opts.chrono)
+  else if (chrono_mode)
     lit_level = assignment_level (lit, reason);
   else
     lit_level = level;
@@ -167,6 +173,13 @@ inline void Internal::search_assign (int lit, Clause *reason) {
   lrat_chain.clear ();
 }
 
+inline void Internal::search_assign (int lit, Clause *reason) {
+  if (opts.chrono)
+    search_assign<true> (lit, reason);
+  else
+    search_assign<false> (lit, reason);
+}
+
 /*------------------------------------------------------------------------*/
 
 // External versions of 'search_assign' which are not inlined.  They either
@@ -206,6 +219,78 @@ void Internal::search_assign_external (int lit) {
 
 /*------------------------------------------------------------------------*/
 
+// Trail saving as described by Hickey and Bacchus (SAT'20).  On back-jumps
+// after conflict analysis ('save_trail' true) the literals unassigned on
+// the levels between the new level and the conflict level are saved
+// together with their reasons in trail order (decisions with a zero
+// reason).  Most of them are implied again after taking the same
+// decisions.  Thus as soon the next saved literal (a decision initially)
+// is propagated again, the following implied literals up to the next saved
+// decision are assigned directly with their saved reason, instead of
+// waiting for them to be found through visiting watches.  All the other
+// literals in such a reason are false, since they are either on lower
+// levels, which were not touched since saving the trail (every other
+// backtrack clears the saved trail), or have been replayed before.  If a
+// saved literal is false we simply stop and let propagation find the
+// conflict.  Reasons have to remain valid, so garbage collection clears
+// the saved trail too.  Reasons marked as garbage in the meantime, e.g.,
+// by eager subsumption right after the back-jump, might already be deleted
+// in the proof and thus also stop replaying.  The trail is not saved at
+// all if it contains an external reason.  This also works with
+// chronological backtracking since 'search_assign' computes the assignment
+// level from the reason.
+
+void Internal::clear_saved_trail () {
+  saved_trail.clear ();
+  saved_reasons.clear ();
+  saved_head = 0;
+  saved_next = 0;
+}
+
+void Internal::replay_saved_trail () {
+  assert (saved_head < saved_trail.size ());
+  assert (val (saved_trail[saved_head]) > 0);
+  const size_t end = saved_trail.size ();
+  size_t i = saved_head + 1;
+  while (i < end) {
+    Clause *reason = saved_reasons[i];
+    if (!reason)
+      break;
+    if (reason->garbage) {
+      LOG (reason, "saved reason garbage");
+      clear_saved_trail ();
+      return;
+    }
+    const int lit = saved_trail[i];
+    const signed char tmp = val (lit);
+    if (tmp < 0) {
+      LOG (reason, "saved literal %d falsified with reason", lit);
+      clear_saved_trail ();
+      return;
+    }
+    if (!tmp) {
+#ifndef NDEBUG
+      for (const auto &other : *reason)
+        assert (other == lit || val (other) < 0);
+#endif
+      LOG (reason, "replaying saved literal %d with reason", lit);
+      if (lrat)
+        build_chain_for_units (lit, reason, 0);
+      search_assign (lit, reason);
+      stats.trailsave.replayed++;
+    }
+    i++;
+  }
+  if (i == end)
+    clear_saved_trail ();
+  else {
+    saved_head = i;
+    saved_next = saved_trail[i];
+  }
+}
+
+/*------------------------------------------------------------------------*/
+
 // The 'propagate' function is usually the hot-spot of a CDCL SAT solver.
 // The 'trail' stack saves assigned variables and is used here as BFS queue
 // for checking clauses with the negation of assigned variables for being in
@@ -223,24 +308,88 @@ void Internal::search_assign_external (int lit) {
 // propagation costs (2013 JAIR article by Ian Gent) at the expense of four
 // more bytes for each clause.
 
-bool Internal::propagate () {
+// With 'opts.prefetch' set to a positive distance 'd' we look 'd' watches
+// ahead in the watch list and prefetch the header of those long clauses
+// whose blocking literal is not satisfied, in order to hide the latency of
+// the first access to the clause mentioned below.  Clauses accessed within
+// the first 'd' watches of a list could not be prefetched early enough and
+// are counted as (potential) stalls.
+
+// With 'opts.binaryfirst' binary clauses are propagated to completion
+// first (as in 'probe_propagate2' and 'vivify_propagate') before the next
+// literal on the trail is propagated over long clauses.  Binary watches
+// are kept in front of long watches (see 'flush_watches', 'sort_watches'
+// and 'move_last_binary_watch_forward') and thus this binary pass can stop
+// at the first long watch without touching the rest of the watch list.
+// The long clause pass in turn starts after these binary watches.  Binary
+// watches which still occur after long watches are handled in the long
+// clause pass in the same way as without this option.
+
+template <bool lrat_mode, bool chrono_mode>
+inline void Internal::search_propagate2 (int64_t &ticks) {
+  while (propagated2 != trail.size ()) {
+    const int lit = -trail[propagated2++];
+    LOG ("propagating %d over binary clauses", -lit);
+    const Watches &ws = watches (lit);
+    const const_watch_iterator eow = ws.end ();
+    const_watch_iterator i = ws.begin ();
+    while (i != eow) {
+      const Watch &w = *i++;
+      if (!w.binary ())
+        break;
+      const signed char b = val (w.blit);
+      if (b > 0)
+        continue;
+      if (b < 0)
+        conflict = w.clause; // but continue ...
+      else {
+        if (lrat_mode)
+          build_chain_for_units (w.blit, w.clause, 0);
+        search_assign<chrono_mode> (w.blit, w.clause);
+        ticks++;
+      }
+    }
+    ticks += 1 + cache_lines (i - ws.begin (), sizeof *i);
+    if (conflict)
+      break;
+  }
+}
 
-  if (level)
-    require_mode (SEARCH);
-  assert (!unsat);
-  LOG ("starting propagate");
-  START (propagate);
+// The actual propagation loop is specialized at compile time for the
+// modes which otherwise would need to be checked for every propagated
+// literal, i.e., whether LRAT proof chains have to be built and whether
+// chronological backtracking requires to compute assignment levels.  The
+// specialization is picked once per call to 'propagate'.  The common
+// configuration without proofs thus runs a loop without proof checks.
+// Note that there is nothing to specialize for external propagation,
+// since reasons of assignments in this loop are always actual clauses.
 
-  // Updating statistics counter in the propagation loops is costly so we
-  // delay until propagation ran to completion.
-  //
-  int64_t before = propagated;
-  int64_t ticks = 0;
+template <bool lrat_mode, bool chrono_mode>
+void Internal::propagate_literals (int64_t &ticks, int64_t &prefetches,
+                                   int64_t &stalls) {
+
+  assert (lrat_mode == lrat);
+  assert (chrono_mode == (opts.chrono > 0));
 
-  while (!conflict && propagated != trail.size ()) {
+  const size_t prefetch_distance = opts.prefetch;
+  const bool binary_first = opts.binaryfirst;
+  if (binary_first)
+    propagated2 = propagated;
+
+  while (!conflict) {
+
+    if (binary_first && propagated2 != trail.size ()) {
+      search_propagate2<lrat_mode, chrono_mode> (ticks);
+      continue;
+    }
+
+    if (propagated == trail.size ())
+      break;
 
     const int lit = -trail[propagated++];
     LOG ("propagating %d", -lit);
+    if (-lit == saved_next)
+      replay_saved_trail ();
     Watches &ws = watches (lit);
 
     const const_watch_iterator eow = ws.end ();
@@ -248,8 +397,31 @@ bool Internal::propagate () {
     const_watch_iterator i = j;
     ticks += 1 + cache_lines (ws.size (), sizeof *i);
 
+    // The binary watches in front were all just visited in the binary
+    // pass and are satisfied now, thus are skipped without looking up the
+    // value of their other literal.
+
+    if (binary_first)
+      while (i != eow && i->binary ())
+        i++, j++;
+
+    const_watch_iterator prefetched = i;
+
     while (i != eow) {
 
+      if (prefetch_distance) {
+        const const_watch_iterator window =
+            (size_t) (eow - i) > prefetch_distance ? i + prefetch_distance
+                                                   : eow;
+        while (prefetched < window) {
+          const Watch &p = *prefetched++;
+          if (p.binary () || val (p.blit) > 0)
+            continue;
+          __builtin_prefetch (p.clause);
+          prefetches++;
+        }
+      }
+
       const Watch w = *j++ = *i++;
       const signed char b = val (w.blit);
       LOG (w.clause, "checking");
@@ -289,8 +461,9 @@ bool Internal::propagate () {
         if (b < 0)
           conflict = w.clause; // but continue ...
         else {
-          build_chain_for_units (w.blit, w.clause, 0);
-          search_assign (w.blit, w.clause);
+          if (lrat_mode)
+            build_chain_for_units (w.blit, w.clause, 0);
+          search_assign<chrono_mode> (w.blit, w.clause);
           // lrat_chain.clear (); done in search_assign
           ticks++;
         }
@@ -308,6 +481,10 @@ bool Internal::propagate () {
 
         ticks++;
 
+        if (prefetch_distance &&
+            (size_t) (i - ws.begin ()) <= prefetch_distance)
+          stalls++;
+
         if (w.clause->garbage) {
           j--;
           continue;
@@ -340,27 +517,15 @@ bool Internal::propagate () {
           // one failed to find a replacement another one starting at the
           // first non-watched literal until the saved position.
 
+          // Both searches are implemented in 'search_replacement'.
+
           const int size = w.clause->size;
-          const literal_iterator middle = lits + w.clause->pos;
-          const const_literal_iterator end = lits + size;
-          literal_iterator k = middle;
 
           // Find replacement watch 'r' at position 'k' with value 'v'.
-          assert (lits + 2 <= k);
           LOG (w.clause, "search starting at %d", w.clause->pos);
           int r = 0;
           signed char v = -1;
-
-          while (k != end && (v = val (r = *k)) < 0)
-            k++;
-
-          if (v < 0) { // need second search starting at the head?
-
-            k = lits + 2;
-            assert (w.clause->pos <= size);
-            while (k != middle && (v = val (r = *k)) < 0)
-              k++;
-          }
+          literal_iterator k = search_replacement (w.clause, r, v);
 
           w.clause->pos = k - lits; // always save position
 
@@ -395,8 +560,9 @@ bool Internal::propagate () {
             // The other watch is unassigned ('!u') and all other literals
             // assigned to false (still 'v < 0'), thus we found a unit.
             //
-            build_chain_for_units (other, w.clause, 0);
-            search_assign (other, w.clause);
+            if (lrat_mode)
+              build_chain_for_units (other, w.clause, 0);
+            search_assign<chrono_mode> (other, w.clause);
             // lrat_chain.clear (); done in search_assign
             ticks++;
 
@@ -405,7 +571,7 @@ bool Internal::propagate () {
             // first does not really seem to be necessary for correctness,
             // and further does not improve running time either.
             //
-            if (opts.chrono > 1) {
+            if (chrono_mode && opts.chrono > 1) {
 
               const int other_level = var (other).level;
 
@@ -459,6 +625,35 @@ bool Internal::propagate () {
       ws.resize (j - ws.begin ());
     }
   }
+}
+
+bool Internal::propagate () {
+
+  if (level)
+    require_mode (SEARCH);
+  assert (!unsat);
+  LOG ("starting propagate");
+  START (propagate);
+
+  // Updating statistics counter in the propagation loops is costly so we
+  // delay until propagation ran to completion.
+  //
+  int64_t before = propagated;
+  int64_t ticks = 0;
+
+  int64_t prefetches = 0, stalls = 0;
+
+  if (lrat) {
+    if (opts.chrono)
+      propagate_literals<true, true> (ticks, prefetches, stalls);
+    else
+      propagate_literals<true, false> (ticks, prefetches, stalls);
+  } else {
+    if (opts.chrono)
+      propagate_literals<false, true> (ticks, prefetches, stalls);
+    else
+      propagate_literals<false, false> (ticks, prefetches, stalls);
+  }
 
   if (searching_lucky_phases) {
 
@@ -469,8 +664,11 @@ bool Internal::propagate () {
 
     // Avoid updating stats eagerly in the hot-spot of the solver.
     //
-    stats.propagations.search += propagated - before;
+    const size_t after = opts.binaryfirst ? propagated2 : propagated;
+    stats.propagations.search += after - before;
     stats.ticks.search[stable] += ticks;
+    stats.prefetch.issued += prefetches;
+    stats.prefetch.stalls += stalls;
 
     if (!conflict)
       no_conflict_until = propagated;
@@ -537,23 +735,9 @@ void Internal::propergate () {
         continue;
       assert (u < 0);
 
-      const int size = w.clause->size;
-      const literal_iterator middle = lits + w.clause->pos;
-      const const_literal_iterator end = lits + size;
-      literal_iterator k = middle;
-
       int r = 0;
       signed char v = -1;
-
-      while (k != end && (v = val (r = *k)) < 0)
-        k++;
-
-      if (v < 0) {
-        k = lits + 2;
-        assert (w.clause->pos <= size);
-        while (k != middle && (v = val (r = *k)) < 0)
-          k++;
-      }
+      literal_iterator k = search_replacement (w.clause, r, v);
 
       assert (lits + 2 <= k), assert (k <= w.clause->end ());
       w.clause->pos = k - lits;
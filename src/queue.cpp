@@ -2,7 +2,7 @@
 
 namespace CaDiCaL {
 
-// Slightly different than 'bump_variable' since the variable is not
+// Slightly different than 'bump_queue_batch' since the variable is not
 // enqueued at all.
 
 inline void Internal::init_enqueue (int idx) {
@@ -12,13 +12,13 @@ inline void Internal::init_enqueue (int idx) {
     if (queue.first) {
       assert (!links[queue.first].prev);
       links[queue.first].prev = idx;
-      btab[idx] = btab[queue.first] - 1;
+      links[idx].bumped = links[queue.first].bumped - 1;
     } else {
       assert (!queue.last);
       queue.last = idx;
-      btab[idx] = 0;
+      links[idx].bumped = 0;
     }
-    assert (btab[idx] <= stats.bumped);
+    assert (links[idx].bumped <= stats.bumped);
     l.next = queue.first;
     queue.first = idx;
     if (!queue.unassigned)
@@ -32,7 +32,7 @@ inline void Internal::init_enqueue (int idx) {
       assert (!queue.first);
       queue.first = idx;
     }
-    btab[idx] = ++stats.bumped;
+    links[idx].bumped = ++stats.bumped;
     l.prev = queue.last;
     queue.last = idx;
     update_queue_unassigned (queue.last);
@@ -83,7 +83,7 @@ void Internal::shuffle_queue () {
     queue.enqueue (links, idx);
   int64_t bumped = queue.bumped;
   for (int idx = queue.last; idx; idx = links[idx].prev)
-    btab[idx] = bumped--;
+    links[idx].bumped = bumped--;
   queue.unassigned = queue.last;
 }
 
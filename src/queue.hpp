@@ -1,15 +1,20 @@
 #ifndef _queue_hpp_INCLUDED
 #define _queue_hpp_INCLUDED
 
+#include <cstdint>
 #include <vector>
 
 namespace CaDiCaL {
 
-// Links for double linked decision queue.
+// Links for double linked decision queue.  The enqueue time stamp 'bumped'
+// is kept together with the links (instead of a separate table) since it
+// is accessed together with them, while bumping as well as for updating
+// and traversing the queue while searching for the next decision.
 
 struct Link {
 
   int prev, next; // variable indices
+  int64_t bumped; // enqueue time stamp
 
   // initialized explicitly in 'init_queue'
 };
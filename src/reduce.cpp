@@ -68,8 +68,15 @@ void Internal::mark_clauses_to_be_flushed () {
 // In earlier versions we pre-computed a 64-bit sort key per clause and
 // wrapped a pointer to the clause and the 64-bit sort key into a separate
 // data structure for sorting.  This was probably faster but awkward and
-// so we moved back to a simpler scheme which also uses 'stable_sort'
-// instead of 'rsort' below.  Sorting here is not a hot-spot anyhow.
+// so we moved back to a simpler scheme which used 'stable_sort' with this
+// order.  With millions of candidates that sort became a noticeable pause
+// though.  We only need to know which clauses are among the 'target' least
+// useful ones in stable sorted order and not their relative order.  Thus
+// we now select them in linear time by counting glues (and then sizes
+// within the glue bucket cut by the target) instead.  The selected clauses
+// are exactly the same as those of the first 'target' clauses after
+// stable sorting with respect to the following order (which is kept as
+// documentation and for checking).
 
 struct reduce_less_useful {
   bool operator() (const Clause *c, const Clause *d) const {
@@ -81,6 +88,27 @@ struct reduce_less_useful {
   }
 };
 
+// Determine the cut value 'res' of 'key' such that all clauses with a key
+// larger than 'res' are selected and 'rest' more clauses with key 'res'.
+
+template <class K>
+static int reduce_select_cut (const vector<Clause *> &candidates,
+                              size_t target, size_t &rest, K key) {
+  int max_key = 0;
+  for (const auto &c : candidates)
+    max_key = max (max_key, key (c));
+  vector<size_t> count (1 + (size_t) max_key);
+  for (const auto &c : candidates)
+    count[key (c)]++;
+  int res = max_key;
+  size_t above = 0;
+  while (above + count[res] < target)
+    above += count[res--];
+  assert (res >= 0);
+  rest = target - above;
+  return res;
+}
+
 // This function implements the important reduction policy. It determines
 // which redundant clauses are considered not useful and thus will be
 // collected in a subsequent garbage collection phase.
@@ -122,7 +150,6 @@ void Internal::mark_useless_redundant_clauses_as_garbage () {
     stack.push_back (c);
   }
 
-  stable_sort (stack.begin (), stack.end (), reduce_less_useful ());
   size_t target = 1e-2 * opts.reducetarget * stack.size ();
 
   // This is defensive code, which I usually consider a bug, but here I am
@@ -135,20 +162,56 @@ void Internal::mark_useless_redundant_clauses_as_garbage () {
   PHASE ("reduce", stats.reductions, "reducing %zd clauses %.0f%%", target,
          percent (target, stats.current.redundant));
 
-  auto i = stack.begin ();
-  const auto t = i + target;
-  while (i != t) {
-    Clause *c = *i++;
+  // First select all clauses with glue larger than the cut glue and then
+  // among the clauses with the cut glue those with size larger than the
+  // cut size as well as the first ones (in 'clauses' order) of cut size.
+
+  const auto mark_useless = [this] (Clause *c) {
     LOG (c, "marking useless to be collected");
     mark_garbage (c);
     stats.reduced++;
+  };
+
+  if (target) {
+    size_t rest_glue, rest_size;
+    const int glue = reduce_select_cut (
+        stack, target, rest_glue, [] (const Clause *c) { return c->glue; });
+    vector<Clause *> bucket;
+    for (const auto &c : stack)
+      if (c->glue > glue)
+        mark_useless (c);
+      else if (c->glue == glue)
+        bucket.push_back (c);
+    const int size = reduce_select_cut (
+        bucket, rest_glue, rest_size,
+        [] (const Clause *c) { return c->size; });
+    for (const auto &c : bucket) {
+      if (c->size < size)
+        continue;
+      if (c->size == size) {
+        if (!rest_size)
+          continue;
+        rest_size--;
+      }
+      mark_useless (c);
+    }
+    assert (!rest_size);
   }
 
+#ifndef NDEBUG
+  {
+    vector<Clause *> sorted = stack;
+    stable_sort (sorted.begin (), sorted.end (), reduce_less_useful ());
+    for (size_t i = 0; i < sorted.size (); i++)
+      assert (sorted[i]->garbage == (i < target));
+  }
+#endif
+
   lim.keptsize = lim.keptglue = 0;
 
-  const auto end = stack.end ();
-  for (i = t; i != end; i++) {
-    Clause *c = *i;
+  for (const auto &c : stack) {
+    if (c->garbage)
+      continue;
     LOG (c, "keeping");
     if (c->size > lim.keptsize)
       lim.keptsize = c->size;
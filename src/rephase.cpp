@@ -95,10 +95,13 @@ char Internal::rephase_best () {
   return 'B';
 }
 
-// Trigger local search 'walk' in 'walk.cpp'.
+// Trigger local search 'walk' in 'walk.cpp' unless phases found by the
+// local search helper thread in 'walkthread.cpp' are available.
 
 char Internal::rephase_walk () {
   stats.rephased.walk++;
+  if (import_walkthread ())
+    return 'W';
   PHASE ("rephase", stats.rephased.total,
          "starting local search to improve current phase");
   if (opts.walkfullocc)
@@ -27,6 +27,7 @@ extern "C" {
 
 #else
 
+#include <sys/mman.h>
 #include <sys/resource.h>
 #include <sys/time.h>
 #include <sys/types.h>
@@ -34,9 +35,12 @@ extern "C" {
 
 #endif
 
+#include <stdlib.h>
 #include <string.h>
 }
 
+#include <new>
+
 namespace CaDiCaL {
 
 /*------------------------------------------------------------------------*/
@@ -157,4 +161,63 @@ uint64_t current_resident_set_size () {
 
 /*------------------------------------------------------------------------*/
 
+// On Linux, memory backed by transparent huge pages is listed in the
+// 'AnonHugePages' field of '/proc/self/smaps_rollup' (since Linux 4.14).
+
+#ifdef __linux__
+
+uint64_t huge_pages_resident_set_size () {
+  FILE *file = fopen ("/proc/self/smaps_rollup", "r");
+  if (!file)
+    return 0;
+  char line[128];
+  uint64_t res = 0;
+  while (fgets (line, sizeof line, file))
+    if (sscanf (line, "AnonHugePages: %" PRIu64 " kB", &res) == 1)
+      break;
+  fclose (file);
+  return res << 10;
+}
+
+#else
+
+uint64_t huge_pages_resident_set_size () { return 0; }
+
+#endif
+
+/*------------------------------------------------------------------------*/
+
+// Large arrays accessed randomly during search, i.e., the clause arena and
+// the values of literals, cause many TLB misses if they are backed by
+// standard 4KB pages.  If requested we align such memory to 2MB and
+// advise the kernel to back it by transparent huge pages, which is only
+// possible on Linux though.  Otherwise we simply fall back to 'malloc'.
+
+static const size_t huge_page_size = (size_t) 1 << 21;
+
+char *allocate_memory (size_t bytes, bool huge_pages, size_t &advised) {
+  void *res = 0;
+  advised = 0;
+#if !defined(_WIN32) && defined(MADV_HUGEPAGE)
+  if (huge_pages && bytes >= huge_page_size) {
+    const size_t aligned = align (bytes, huge_page_size);
+    if (posix_memalign (&res, huge_page_size, aligned))
+      res = 0;
+    else if (!madvise (res, aligned, MADV_HUGEPAGE))
+      advised = aligned;
+  }
+#else
+  (void) huge_pages;
+#endif
+  if (!res)
+    res = malloc (bytes);
+  if (!res)
+    throw std::bad_alloc ();
+  return (char *) res;
+}
+
+void deallocate_memory (char *p) { free (p); }
+
+/*------------------------------------------------------------------------*/
+
 } // namespace CaDiCaL
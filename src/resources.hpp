@@ -1,6 +1,7 @@
 #ifndef _resources_hpp_INCLUDED
 #define _resources_hpp_INCLUDED
 
+#include <cstddef>
 #include <cstdint>
 
 namespace CaDiCaL {
@@ -10,6 +11,15 @@ double absolute_process_time ();
 
 uint64_t maximum_resident_set_size ();
 uint64_t current_resident_set_size ();
+uint64_t huge_pages_resident_set_size ();
+
+// Allocate memory (to be released with 'deallocate_memory') which is
+// aligned to huge pages and advised to be backed by transparent huge pages
+// if 'huge_pages' is true, it is large enough and this is supported by
+// the operating system.  The number of advised bytes is saved in 'advised'.
+
+char *allocate_memory (size_t bytes, bool huge_pages, size_t &advised);
+void deallocate_memory (char *);
 
 } // namespace CaDiCaL
 
@@ -166,7 +166,14 @@ void Internal::restart () {
   if (stable)
     stats.restartstable++;
   LOG ("restart %" PRId64 "", stats.restarts);
-  backtrack (reuse_trail ());
+  const bool import = importing ();
+  backtrack (import ? 0 : reuse_trail ());
+  if (import)
+    import_clauses ();
+  if (backgrounding ())
+    start_background ();
+  if (walkthreading ())
+    start_walkthread ();
 
   lim.restart = stats.conflicts + opts.restartint;
   LOG ("new restart limit at %" PRId64 " conflicts", lim.restart);
@@ -19,42 +19,21 @@ void Internal::reset_shrinkable () {
   LOG ("resetting %zu shrinkable variables", reset);
 }
 
-void Internal::mark_shrinkable_as_removable (
-    int blevel, std::vector<int>::size_type minimized_start) {
+void Internal::mark_shrinkable_as_removable () {
 #ifdef LOGGING
   size_t marked = 0, reset = 0;
 #endif
-#ifndef NDEBUG
-  unsigned kept = 0, minireset = 0;
-  for (; minimized_start < minimized.size (); ++minimized_start) {
-    const int lit = minimized[minimized_start];
-    Flags &f = flags (lit);
-    const Var &v = var (lit);
-    if (v.level == blevel) {
-      assert (!f.poison);
-      ++minireset;
-    } else
-      ++kept;
-  }
-  (void) kept;
-  (void) minireset;
-#else
-  (void) blevel;
-  (void) minimized_start;
-#endif
-
   for (const int lit : shrinkable) {
     Flags &f = flags (lit);
     assert (f.shrinkable);
-    assert (!f.poison);
+    assert (!minimize_marked (lit, POISON));
     f.shrinkable = false;
 #ifdef LOGGING
     ++reset;
 #endif
-    if (f.removable)
+    if (minimize_marked (lit, REMOVABLE))
       continue;
-    f.removable = true;
-    minimized.push_back (lit);
+    minimize_mark (lit, REMOVABLE);
 #ifdef LOGGING
     ++marked;
 #endif
@@ -91,7 +70,7 @@ int inline Internal::shrink_literal (int lit, int blevel,
   }
 
   if (v.level < blevel) {
-    if (f.removable) {
+    if (minimize_marked (lit, REMOVABLE)) {
       LOG ("skipping removable thus shrinkable %d", (lit));
       return 0;
     }
@@ -107,7 +86,7 @@ int inline Internal::shrink_literal (int lit, int blevel,
 
   LOG ("marking %d as shrinkable", lit);
   f.shrinkable = true;
-  f.poison = false;
+  minimize_unmark (lit, POISON);
   shrinkable.push_back (lit);
   if (opts.shrinkreap) {
     assert (max_trail < trail.size ());
@@ -119,9 +98,9 @@ int inline Internal::shrink_literal (int lit, int blevel,
 
 unsigned Internal::shrunken_block_uip (
     int uip, int blevel, std::vector<int>::reverse_iterator &rbegin_block,
-    std::vector<int>::reverse_iterator &rend_block,
-    std::vector<int>::size_type minimized_start, const int uip0) {
+    std::vector<int>::reverse_iterator &rend_block, const int uip0) {
   assert (clause[0] == uip0);
+  (void) blevel;
 
   LOG ("UIP on level %u, uip: %i (replacing by %i)", blevel, uip, uip0);
   assert (rend_block > rbegin_block);
@@ -149,7 +128,7 @@ unsigned Internal::shrunken_block_uip (
     ++block_shrunken;
     assert (clause[0] == uip0);
   }
-  mark_shrinkable_as_removable (blevel, minimized_start);
+  mark_shrinkable_as_removable ();
   assert (clause[0] == uip0);
   return block_shrunken;
 }
@@ -295,7 +274,6 @@ Internal::shrink_block (std::vector<int>::reverse_iterator &rbegin_lits,
   const bool resolve_large_clauses = (opts.shrink > 1);
   bool failed = false;
   unsigned block_shrunken = 0;
-  std::vector<int>::size_type minimized_start = minimized.size ();
   int uip = uip0;
   unsigned max_trail2 = max_trail;
 
@@ -327,7 +305,7 @@ Internal::shrink_block (std::vector<int>::reverse_iterator &rbegin_lits,
                                                 block_minimized, uip0);
   else
     block_shrunken = shrunken_block_uip (uip, blevel, rbegin_lits,
-                                         rend_block, minimized_start, uip0);
+                                         rend_block, uip0);
 
   if (opts.shrinkreap)
     reap.clear ();
@@ -409,7 +387,6 @@ std::vector<int>::reverse_iterator Internal::minimize_and_shrink_block (
   unsigned block_shrunken = 0, block_minimized = 0;
   if (open < 2) {
     flags (*rbegin_block).keep = true;
-    minimized.push_back (*rbegin_block);
   } else
     block_shrunken = shrink_block (rbegin_block, rend_block, blevel, open,
                                    block_minimized, uip0, max_trail);
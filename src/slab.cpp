@@ -0,0 +1,65 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+Slab::Slab (Internal *i)
+    : internal (i), top (0), end (0), free_lists (max_class + 1, 0),
+      live (0) {}
+
+Slab::~Slab () {
+  for (const auto &chunk : chunks)
+    delete[] chunk;
+}
+
+char *Slab::allocate (unsigned size_class) {
+  assert (0 < size_class && size_class <= max_class);
+  live++;
+  char *res = free_lists[size_class];
+  if (res) {
+    free_lists[size_class] = *(char **) res;
+    internal->stats.slab.reused++;
+    return res;
+  }
+  const size_t bytes = 8 * (size_t) size_class;
+  if ((size_t) (end - top) < bytes) {
+    char *chunk = new char[chunk_bytes];
+    chunks.push_back (chunk);
+    top = chunk;
+    end = chunk + chunk_bytes;
+    LOG ("new slab chunk %zd of %zd bytes", chunks.size (), chunk_bytes);
+  }
+  res = top;
+  top += bytes;
+  return res;
+}
+
+void Slab::deallocate (char *p, unsigned size_class) {
+  assert (0 < size_class && size_class <= max_class);
+  assert (live);
+  *(char **) p = free_lists[size_class];
+  free_lists[size_class] = p;
+  if (!--live)
+    reset ();
+}
+
+// Called if no object is allocated anymore.  Keep only the last chunk and
+// restart bump allocation from its beginning, which also keeps clauses
+// allocated after each other close to each other.
+
+void Slab::reset () {
+  assert (!live);
+  assert (!chunks.empty ());
+  char *last = chunks.back ();
+  chunks.pop_back ();
+  for (const auto &chunk : chunks)
+    delete[] chunk;
+  chunks.clear ();
+  chunks.push_back (last);
+  top = last;
+  end = last + chunk_bytes;
+  for (auto &free_list : free_lists)
+    free_list = 0;
+  LOG ("reset slab allocator");
+}
+
+} // namespace CaDiCaL
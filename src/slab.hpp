@@ -0,0 +1,67 @@
+#ifndef _slab_hpp_INCLUDED
+#define _slab_hpp_INCLUDED
+
+#include <vector>
+
+namespace CaDiCaL {
+
+using namespace std;
+
+// Clauses allocated by 'new_clause' (learned clauses, resolvents in bounded
+// variable elimination, ternary resolution, factoring, strengthened
+// clauses) live outside of the 'Arena' until the next moving garbage
+// collection.  With high conflict rates allocating and deleting them
+// individually with 'new' and 'delete' shows up in profiles.  Instead
+// small clauses are allocated from this slab allocator.  It carves objects
+// out of large chunks of memory and keeps a free list for each size
+// class, where size classes are multiples of 8 bytes (all clauses are 8
+// byte aligned anyhow, see 'Clause::bytes').
+
+// Since clauses can be shrunken in place, the size of a clause at the point
+// it is deallocated does not determine its size class anymore.  Thus the
+// size class is stored in the clause (see 'Clause::slab').
+
+// Clauses surviving a garbage collection are moved to the arena, which
+// usually leaves the slab allocator empty.  At that point all chunks but
+// one are released and allocation restarts at the beginning of that chunk.
+
+struct Internal;
+
+class Slab {
+
+  Internal *internal;
+
+  vector<char *> chunks; // allocated chunks (current one last)
+  char *top, *end;       // bump allocation in current chunk
+
+  vector<char *> free_lists; // indexed by size class
+  size_t live;               // number of allocated objects
+
+  void reset ();
+
+public:
+  // Objects up to 'max_class * 8' bytes are allocated in chunks of
+  // 'chunk_bytes' bytes.  The size class has to fit 'Clause::slab'.
+  //
+  static const unsigned max_class = 63;
+  static const size_t chunk_bytes = (size_t) 1 << 20;
+
+  Slab (Internal *);
+  ~Slab ();
+
+  // Return the size class for 'bytes' or zero if too large.
+  //
+  static unsigned size_class (size_t bytes) {
+    const size_t res = (bytes + 7) / 8;
+    return res <= max_class ? res : 0;
+  }
+
+  char *allocate (unsigned size_class);
+  void deallocate (char *, unsigned size_class);
+
+  size_t reserved () const { return chunks.size () * chunk_bytes; }
+};
+
+} // namespace CaDiCaL
+
+#endif
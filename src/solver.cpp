@@ -1014,6 +1014,45 @@ void Solver::disconnect_learner () {
 
 /*===== IPASIR END =======================================================*/
 
+void Solver::connect_importer (Importer *importer) {
+  LOG_API_CALL_BEGIN ("connect_importer");
+  REQUIRE_VALID_STATE ();
+  REQUIRE (importer, "can not connect zero importer");
+#ifdef LOGGING
+  if (external->importer)
+    LOG ("connecting new importer (disconnecting previous one)");
+  else
+    LOG ("connecting new importer (no previous one)");
+#endif
+  external->importer = importer;
+  LOG_API_CALL_END ("connect_importer");
+}
+
+void Solver::disconnect_importer () {
+  LOG_API_CALL_BEGIN ("disconnect_importer");
+  REQUIRE_VALID_STATE ();
+#ifdef LOGGING
+  if (external->importer)
+    LOG ("disconnecting previous importer");
+  else
+    LOG ("ignoring to disconnect importer (no previous one)");
+#endif
+  external->importer = 0;
+  LOG_API_CALL_END ("disconnect_importer");
+}
+
+// Neither logged nor traced and without checking the state of the solver,
+// since all of those are not thread-safe.
+
+bool Solver::import_clause (const std::vector<int> &clause) {
+  REQUIRE_INITIALIZED ();
+  for (const auto &lit : clause)
+    REQUIRE (lit && lit != INT_MIN, "invalid literal '%d'", lit);
+  return internal->exchange.push (clause.data (), clause.size ());
+}
+
+/*------------------------------------------------------------------------*/
+
 void Solver::connect_fixed_listener (
     FixedAssignmentListener *fixed_listener) {
   LOG_API_CALL_BEGIN ("connect_fixed_listener");
@@ -1836,6 +1875,8 @@ int64_t Solver::get_statistic_value (const char *opt) const {
            internal->stats.all.fasteliminated;
   if (!strcmp (opt, "subsitutued"))
     return internal->stats.all.substituted;
+  if (!strcmp (opt, "imported"))
+    return internal->stats.imported.clauses;
   return -1;
 }
 } // namespace CaDiCaL
@@ -393,6 +393,14 @@ void Stats::print (Internal *internal) {
          percent (stats.otfs.strengthened, stats.conflicts));
   }
 
+  if (all || stats.prefetch.issued) {
+    PRT ("prefetched:      %15" PRId64 "   %10.2f    per propagation",
+         stats.prefetch.issued,
+         relative (stats.prefetch.issued, stats.propagations.search));
+    PRT ("  stalls:        %15" PRId64 "   %10.2f %%  of prefetched",
+         stats.prefetch.stalls,
+         percent (stats.prefetch.stalls, stats.prefetch.issued));
+  }
   PRT ("propagations:    %15" PRId64 "   %10.2f M  per second",
        propagations, relative (propagations / 1e6, t));
   PRT ("  coverprops:    %15" PRId64 "   %10.2f %%  of propagations",
@@ -410,6 +418,44 @@ void Stats::print (Internal *internal) {
   PRT ("  vivifyprops:   %15" PRId64 "   %10.2f %%  of propagations",
        stats.propagations.vivify,
        percent (stats.propagations.vivify, propagations));
+  if (all || stats.trailsave.saved) {
+    PRT ("trailsaved:      %15" PRId64 "   %10.2f    per conflict",
+         stats.trailsave.saved,
+         relative (stats.trailsave.saved, stats.conflicts));
+    PRT ("  replayed:      %15" PRId64 "   %10.2f %%  searchprops",
+         stats.trailsave.replayed,
+         percent (stats.trailsave.replayed, stats.propagations.search));
+  }
+  if (all || stats.background.started) {
+    PRT ("background:      %15" PRId64 "   %10.2f    interval",
+         stats.background.started,
+         relative (stats.conflicts, stats.background.started));
+    PRT ("  bgunits:       %15" PRId64 "   %10.2f    per background",
+         stats.background.units,
+         relative (stats.background.units, stats.background.started));
+    PRT ("  bgbinaries:    %15" PRId64 "   %10.2f    per background",
+         stats.background.binaries,
+         relative (stats.background.binaries, stats.background.started));
+    PRT ("  bgdropped:     %15" PRId64 "   %10.2f    per background",
+         stats.background.dropped,
+         relative (stats.background.dropped, stats.background.started));
+  }
+  if (all || stats.imported.clauses || stats.imported.units) {
+    const int64_t imported = stats.imported.clauses + stats.imported.units;
+    PRT ("imported:        %15" PRId64 "   %10.2f    per restart",
+         imported, relative (imported, stats.restarts));
+    PRT ("  importunits:   %15" PRId64 "   %10.2f %%  of imported",
+         stats.imported.units, percent (stats.imported.units, imported));
+    PRT ("  importsat:     %15" PRId64 "   %10.2f %%  of imported",
+         stats.imported.satisfied,
+         percent (stats.imported.satisfied, imported));
+    PRT ("  importskipped: %15" PRId64 "   %10.2f %%  of imported",
+         stats.imported.skipped,
+         percent (stats.imported.skipped, imported));
+    PRT ("  importdups:    %15" PRId64 "   %10.2f %%  of imported",
+         stats.imported.duplicated,
+         percent (stats.imported.duplicated, imported));
+  }
   if (all || stats.reactivated) {
     PRT ("reactivated:     %15" PRId64 "   %10.2f %%  of all variables",
          stats.reactivated, percent (stats.reactivated, stats.vars));
@@ -428,6 +474,32 @@ void Stats::print (Internal *internal) {
     PRT ("  collections:   %15" PRId64 "   %10.2f    interval",
          stats.collections, relative (stats.conflicts, stats.collections));
   }
+  if (all || stats.arena.partial) {
+    PRT ("partial:         %15" PRId64 "   %10.2f %%  collections",
+         stats.arena.partial,
+         percent (stats.arena.partial, stats.collections));
+    PRT ("  moved:         %15" PRId64 "   %10.2f    MB per collection",
+         stats.arena.moved,
+         relative (stats.arena.moved / (double) (1l << 20),
+                   stats.collections));
+    PRT ("  exceeded:      %15" PRId64 "   %10.2f %%  partial",
+         stats.arena.exceeded,
+         percent (stats.arena.exceeded, stats.arena.partial));
+  }
+  if (all || stats.slab.allocated) {
+    const int64_t clauses = stats.slab.allocated + stats.slab.heap;
+    PRT ("slab:            %15" PRId64 "   %10.2f %%  new clauses",
+         stats.slab.allocated, percent (stats.slab.allocated, clauses));
+    PRT ("  reused:        %15" PRId64 "   %10.2f %%  slab",
+         stats.slab.reused,
+         percent (stats.slab.reused, stats.slab.allocated));
+    PRT ("  bytes:         %15" PRId64 "   %10.2f    per slab clause",
+         stats.slab.bytes,
+         relative (stats.slab.bytes, stats.slab.allocated));
+    const int64_t reserved = internal->slab.reserved ();
+    PRT ("  reserved:      %15" PRId64 "   %10.2f    MB",
+         reserved, reserved / (double) (1l << 20));
+  }
   if (all || stats.rephased.total) {
     PRT ("rephased:        %15" PRId64 "   %10.2f    interval",
          stats.rephased.total,
@@ -777,6 +849,17 @@ void Stats::print (Internal *internal) {
          stats.walk.improved,
          relative (stats.walk.improved, stats.walk.count));
   }
+  if (all || stats.walkthread.started) {
+    PRT ("walkthread:      %15" PRId64 "   %10.2f    interval",
+         stats.walkthread.started,
+         relative (stats.conflicts, stats.walkthread.started));
+    PRT ("  wtflips:       %15" PRId64 "   %10.2f    per walkthread",
+         stats.walkthread.flips,
+         relative (stats.walkthread.flips, stats.walkthread.started));
+    PRT ("  wtimported:    %15" PRId64 "   %10.2f %%  rephased walk",
+         stats.walkthread.imported,
+         percent (stats.walkthread.imported, stats.rephased.walk));
+  }
   if (all || stats.weakened) {
     PRT ("weakened:        %15" PRId64 "   %10.2f    average size",
          stats.weakened, relative (stats.weakenedlen, stats.weakened));
@@ -849,6 +932,13 @@ void Internal::print_resource_usage () {
        internal->real_time ());
   MSG ("maximum resident set size of process:    %12.2f    MB",
        m / (double) (1l << 20));
+  if (opts.hugepages) {
+    const size_t advised = arena.advised () + vals_advised;
+    MSG ("advised huge pages of arena and values:  %12.2f    MB",
+         advised / (double) (1l << 20));
+    MSG ("huge pages backed memory of process:     %12.2f    MB",
+         huge_pages_resident_set_size () / (double) (1l << 20));
+  }
 #endif
 }
 
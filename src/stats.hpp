@@ -29,6 +29,31 @@ struct Stats {
     int64_t backbone = 0;    // propagated during backbones
   } propagations;
 
+  struct {
+    int64_t saved = 0;    // literals saved on back-jumps
+    int64_t replayed = 0; // saved literals assigned again during search
+  } trailsave;
+
+  struct {
+    int64_t clauses = 0;    // imported clauses (including the empty clause)
+    int64_t units = 0;      // imported units
+    int64_t satisfied = 0;  // skipped imported clauses (root satisfied)
+    int64_t skipped = 0;    // skipped imported clauses (removed variables)
+    int64_t duplicated = 0; // skipped imported clauses (imported before)
+  } imported;
+
+  struct {
+    int64_t started = 0;  // snapshots simplified in background
+    int64_t units = 0;    // units derived in background
+    int64_t binaries = 0; // binary clauses derived in background
+    int64_t dropped = 0;  // results dropped (import buffer full)
+  } background;
+
+  struct {
+    int64_t issued = 0; // clause prefetches issued in 'propagate'
+    int64_t stalls = 0; // clauses accessed before full prefetch distance
+  } prefetch;
+
   struct {
     int64_t search[2] = {0};
     int64_t backbone = 0;
@@ -140,12 +165,31 @@ struct Stats {
     int64_t improved = 0;
   } walk;
 
+  struct {
+    int64_t started = 0;  // local search helper threads started
+    int64_t flips = 0;    // flips in helper threads
+    int64_t imported = 0; // phases imported from helper threads
+  } walkthread;
+
   struct {
     int64_t count = 0;   // flushings of learned clauses counter
     int64_t learned = 0; // flushed learned clauses
     int64_t hyper = 0;   // flushed hyper binary/ternary clauses
   } flush;
 
+  struct {
+    int64_t moved = 0;    // bytes moved by arena garbage collections
+    int64_t partial = 0;  // collections keeping some arena regions
+    int64_t exceeded = 0; // moved more than 'opts.arenaslice'
+  } arena;
+
+  struct {
+    int64_t allocated = 0; // clauses allocated in slab allocator
+    int64_t reused = 0;    // allocations from free lists
+    int64_t bytes = 0;     // bytes allocated in slab allocator
+    int64_t heap = 0;      // clauses allocated on the heap instead
+  } slab;
+
   int64_t compacts = 0;      // number of compactifications
   int64_t shuffled = 0;      // shuffled queues and scores
   int64_t restarts = 0;      // actual number of happened restarts
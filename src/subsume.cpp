@@ -279,6 +279,16 @@ inline int Internal::try_to_subsume_clause (Clause *c,
 
   unmark (c);
 
+  return subsume_or_strengthen_clause (c, d, flipped, shrunken);
+}
+
+// Apply the result 'flipped' of checking 'd' against the candidate clause
+// 'c' as returned by 'subsume_check' and return the same result as
+// 'try_to_subsume_clause'.
+
+inline int
+Internal::subsume_or_strengthen_clause (Clause *c, Clause *d, int flipped,
+                                        vector<Clause *> &shrunken) {
   if (flipped == INT_MIN) {
     LOG (d, "subsuming");
     subsume_clause (d, c);
@@ -322,6 +332,200 @@ struct subsume_less_noccs {
   }
 };
 
+/*------------------------------------------------------------------------*/
+#ifndef NTHREADS
+
+// With 'opts.subsumethreads' larger than one the schedule is processed in
+// batches.  The candidates of a batch are first checked in parallel by
+// worker threads against the clauses connected before the batch, which are
+// not modified while the workers run.  Each worker has its own marks and
+// uses a variant of 'subsume_check' which does not move literals in the
+// subsuming clause.  The results are stored per candidate and applied
+// sequentially in schedule order.  As candidates in the same batch might
+// subsume each other, candidates without result are checked again
+// sequentially but only against the clauses connected during the batch.
+// These are found through the size of the occurrence lists recorded when
+// the first clause of the batch was connected to them.  Since the batch
+// size is fixed, the outcome is the same for any number of threads larger
+// than one (but differs from the sequential algorithm).
+
+static const size_t subsume_batch_size = 1u << 12;
+
+struct SubsumeCheck {
+  Clause *subsuming; // zero if neither subsumed nor strengthened
+  int flipped;       // as returned by 'subsume_check'
+  int binary[2];     // literals of a subsuming binary clause ...
+  int64_t id;        // ... and its identifier
+};
+
+struct SubsumeOffsets {
+  vector<unsigned> occs, bins; // sizes at start of batch or 'UINT_MAX'
+  vector<unsigned> touched;    // literals connected during batch
+};
+
+struct SubsumeWorker {
+
+  Internal *internal;
+  vector<signed char> marks; // private marks indexed by variables
+  int64_t checks, checks2;
+
+  SubsumeWorker (Internal *i)
+      : internal (i), marks (i->max_var + 1, 0), checks (0), checks2 (0) {}
+
+  signed char marked (int lit) const {
+    const signed char res = marks[abs (lit)];
+    return lit < 0 ? -res : res;
+  }
+
+  int check (const Clause *subsuming) {
+    checks++;
+    if (subsuming->size == 2)
+      checks2++;
+    int flipped = 0;
+    for (const auto &lit : *subsuming) {
+      const int tmp = marked (lit);
+      if (!tmp)
+        return 0;
+      if (tmp > 0)
+        continue;
+      if (flipped)
+        return 0;
+      flipped = lit;
+    }
+    if (!flipped)
+      return INT_MIN;
+    if (!internal->opts.subsumestr)
+      return 0;
+    return flipped;
+  }
+
+  // Same search as in 'try_to_subsume_clause' but with the result stored
+  // in 'res' and if 'offsets' is given restricted to the clauses connected
+  // during the current batch.
+
+  bool find (const Clause *c, SubsumeCheck &res,
+             const SubsumeOffsets *offsets) {
+    for (const auto &lit : *c) {
+      if (!internal->flags (lit).subsume)
+        continue;
+      for (int sign = -1; sign <= 1; sign += 2) {
+        const unsigned ulit = internal->vlit (sign * lit);
+        const Bins &bs = internal->bins (sign * lit);
+        size_t i = offsets ? min ((size_t) offsets->bins[ulit], bs.size ())
+                           : 0;
+        for (; i < bs.size (); i++) {
+          const int other = bs[i].lit;
+          const int tmp = marked (other);
+          if (!tmp)
+            continue;
+          if (tmp < 0 && sign < 0)
+            continue;
+          if (tmp < 0) {
+            res.binary[0] = lit;
+            res.flipped = other;
+          } else {
+            res.binary[0] = sign * lit;
+            res.flipped = (sign < 0) ? -lit : INT_MIN;
+          }
+          res.binary[1] = other;
+          res.id = bs[i].id;
+          res.subsuming = internal->dummy_binary;
+          return true;
+        }
+        const Occs &os = internal->occs (sign * lit);
+        i = offsets ? min ((size_t) offsets->occs[ulit], os.size ()) : 0;
+        for (; i < os.size (); i++) {
+          Clause *e = os[i];
+          assert (!e->garbage);
+          const int flipped = check (e);
+          if (!flipped)
+            continue;
+          res.subsuming = e;
+          res.flipped = flipped;
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+
+  void check (const Clause *c, SubsumeCheck &res,
+              const SubsumeOffsets *offsets) {
+    for (const auto &lit : *c)
+      marks[abs (lit)] = lit < 0 ? -1 : 1;
+    res.subsuming = 0;
+    res.flipped = 0;
+    find (c, res, offsets);
+    for (const auto &lit : *c)
+      marks[abs (lit)] = 0;
+  }
+
+  // Check every 'threads' candidate starting at 'begin + offset'.
+
+  void run (const vector<ClauseSize> *schedule, size_t begin, size_t end,
+            size_t offset, size_t threads, vector<SubsumeCheck> *results) {
+    for (size_t i = begin + offset; i < end; i += threads) {
+      const Clause *c = (*schedule)[i].clause;
+      SubsumeCheck &res = (*results)[i - begin];
+      if (c->size > 2 && c->subsume)
+        check (c, res, 0);
+      else
+        res.subsuming = 0;
+    }
+  }
+};
+
+// The workers and the helper threads are kept for the whole round.
+
+struct SubsumeCheckers : public HelperJob {
+
+  vector<SubsumeWorker> workers; // first one used by the solver thread
+  Helpers helpers;
+
+  const vector<ClauseSize> *schedule; // current batch ...
+  size_t begin, end;                  // ... of candidates
+  vector<SubsumeCheck> *results;
+
+  SubsumeCheckers (Internal *internal, size_t threads)
+      : helpers (threads), schedule (0), begin (0), end (0), results (0) {
+    for (size_t t = 0; t < threads; t++)
+      workers.push_back (SubsumeWorker (internal));
+  }
+
+  void work (size_t t) {
+    workers[t].run (schedule, begin, end, t, workers.size (), results);
+  }
+
+  void check (const vector<ClauseSize> &s, size_t b, size_t e,
+              vector<SubsumeCheck> &r) {
+    r.resize (e - b);
+    schedule = &s, begin = b, end = e, results = &r;
+    helpers.run (*this);
+  }
+};
+
+// The number of checks of the workers is only added to the statistics
+// before the next batch and thus the check limit is only tested there.
+
+static void flush_subsume_checks (Internal *internal,
+                                  SubsumeCheckers *checkers) {
+  for (auto &worker : checkers->workers) {
+    internal->stats.subchecks += worker.checks;
+    internal->stats.subchecks2 += worker.checks2;
+    worker.checks = worker.checks2 = 0;
+  }
+}
+
+static void record_subsume_offset (vector<unsigned> &sizes,
+                                   SubsumeOffsets &offsets, unsigned ulit,
+                                   size_t size) {
+  if (sizes[ulit] != UINT_MAX)
+    return;
+  sizes[ulit] = size;
+  offsets.touched.push_back (ulit);
+}
+
+#endif
 /*------------------------------------------------------------------------*/
 
 // Usually called from 'subsume' below if 'subsuming' triggered it.  Then
@@ -452,14 +656,45 @@ bool Internal::subsume_round () {
   init_occs ();
   init_bins ();
 
-  for (const auto &s : schedule) {
+#ifndef NTHREADS
+  const size_t threads = opts.subsumethreads;
+  SubsumeCheckers *checkers = 0;
+  vector<SubsumeCheck> results;
+  SubsumeOffsets offsets;
+  size_t batch_begin = 0, batch_end = 0;
+  if (threads > 1) {
+    PHASE ("subsume-round", stats.subsumerounds,
+           "checking candidates with %zu threads", threads);
+    checkers = new SubsumeCheckers (this, threads);
+    const size_t size = 2 * (size_t) (max_var + 1);
+    offsets.occs.resize (size, UINT_MAX);
+    offsets.bins.resize (size, UINT_MAX);
+  }
+#endif
+
+  for (size_t i = 0; i < schedule.size (); i++) {
 
     if (terminated_asynchronously ())
       break;
+
+#ifndef NTHREADS
+    if (threads > 1 && i == batch_end) {
+      flush_subsume_checks (this, checkers);
+      for (const auto &ulit : offsets.touched)
+        offsets.occs[ulit] = offsets.bins[ulit] = UINT_MAX;
+      offsets.touched.clear ();
+      if (stats.subchecks < check_limit) {
+        batch_begin = i;
+        batch_end = min (schedule.size (), i + subsume_batch_size);
+        checkers->check (schedule, batch_begin, batch_end, results);
+      }
+    }
+#endif
+
     if (stats.subchecks >= check_limit)
       break;
 
-    Clause *c = s.clause;
+    Clause *c = schedule[i].clause;
     assert (!c->garbage);
 
     checked++;
@@ -474,7 +709,24 @@ bool Internal::subsume_round () {
     //
     if (c->size > 2 && c->subsume) {
       c->subsume = false;
-      const int tmp = try_to_subsume_clause (c, shrunken);
+      int tmp;
+#ifndef NTHREADS
+      if (threads > 1) {
+        stats.subtried++;
+        SubsumeCheck &res = results[i - batch_begin];
+        if (!res.subsuming)
+          checkers->workers[0].check (c, res, &offsets);
+        Clause *d = res.subsuming;
+        if (d == dummy_binary) {
+          dummy_binary->literals[0] = res.binary[0];
+          dummy_binary->literals[1] = res.binary[1];
+          dummy_binary->id = res.id;
+        }
+        tmp = d ? subsume_or_strengthen_clause (c, d, res.flipped, shrunken)
+                : 0;
+      } else
+#endif
+        tmp = try_to_subsume_clause (c, shrunken);
       if (tmp > 0) {
         subsumed++;
         continue;
@@ -528,6 +780,11 @@ bool Internal::subsume_round () {
            "watching %d with %zd current and total %" PRId64 " occurrences",
            minlit, minsize, minoccs);
 
+#ifndef NTHREADS
+      if (threads > 1)
+        record_subsume_offset (offsets.occs, offsets, vlit (minlit),
+                               minsize);
+#endif
       occs (minlit).push_back (c);
 
       // This sorting should give faster failures for assumption checks
@@ -555,10 +812,22 @@ bool Internal::subsume_round () {
 
       const int minlit_pos = (c->literals[1] == minlit);
       const int other = c->literals[!minlit_pos];
+#ifndef NTHREADS
+      if (threads > 1)
+        record_subsume_offset (offsets.bins, offsets, vlit (minlit),
+                               minsize);
+#endif
       bins (minlit).push_back (Bin{other, c->id});
     }
   }
 
+#ifndef NTHREADS
+  if (checkers) {
+    flush_subsume_checks (this, checkers);
+    delete checkers;
+  }
+#endif
+
   PHASE ("subsume-round", stats.subsumerounds,
          "subsumed %" PRId64 " and strengthened %" PRId64 " out of %" PRId64
          " clauses %.0f%%",
@@ -1,5 +1,9 @@
 #include "internal.hpp"
 
+#ifndef NTHREADS
+#include <unordered_set>
+#endif
+
 namespace CaDiCaL {
 
 Sweeper::Sweeper (Internal *i)
@@ -216,6 +220,7 @@ void Internal::init_sweeper (Sweeper &sweeper) {
   sweeper.reprs += max_var;
   enlarge_zero (sweeper.prev, max_var + 1);
   enlarge_zero (sweeper.next, max_var + 1);
+  enlarge_zero (sweeper.promising, max_var + 1);
   for (const auto &lit : lits)
     sweeper.reprs[lit] = lit;
   sweeper.first = sweeper.last = 0;
@@ -276,6 +281,7 @@ void Internal::release_sweeper (Sweeper &sweeper) {
   erase_vector (sweeper.depths);
   erase_vector (sweeper.prev);
   erase_vector (sweeper.next);
+  erase_vector (sweeper.promising);
   erase_vector (sweeper.vars);
   erase_vector (sweeper.clause);
   erase_vector (sweeper.backbone);
@@ -950,6 +956,7 @@ void Internal::schedule_inner (Sweeper &sweeper, int idx) {
   assert (idx);
   if (!active (idx))
     return;
+  sweeper.promising[idx] = 0;
   const int next = sweeper.next[idx];
   if (next != 0) {
     LOG ("rescheduling inner %d as last", idx);
@@ -1875,6 +1882,312 @@ void Internal::unschedule_sweeping (Sweeper &sweeper, unsigned swept,
          swept, incomplete, percent (incomplete, scheduled));
 }
 
+/*------------------------------------------------------------------------*/
+#ifndef NTHREADS
+
+// With 'opts.sweepthreads' larger than one the next scheduled variables are
+// first swept in batches by worker threads, each with its own 'kitten'
+// instance.  A worker builds the environment of a variable as above (but
+// without randomization), solves it and tries its backbone and equivalence
+// candidates.  If it is known that none of them holds the variable is not
+// promising and the main thread does not sweep it at all (unless it is
+// rescheduled and checked again).  Otherwise it is swept as before by the
+// main thread, which thus extracts the proofs of all units and
+// equivalences and substitutes them centrally in
+// 'sweep_substitute_new_equivalences'.  Workers only read the formula and
+// the representatives while the main thread waits.  The remaining sweeping
+// ticks are split evenly among the variables of a batch, which bounds the
+// ticks of each 'kitten' call of a worker.  The maximum number of ticks
+// spent by a worker in a batch is added to the sweeping ticks.  The batch
+// size is fixed and the workers and their threads are kept for the whole
+// sweeping round.
+
+static const size_t sweep_batch_size = 1u << 4;
+
+struct SweepWorker {
+
+  Internal *internal;
+  Sweeper *sweeper;
+  kitten *citten;
+  vector<bool> marked; // variables in environment
+  std::unordered_set<Clause *> swept;
+  vector<int> vars, clause, backbone, partition;
+  unsigned encoded;
+  uint64_t limit, ticks;
+
+  SweepWorker (Internal *i, Sweeper *s)
+      : internal (i), sweeper (s), citten (0), encoded (0), limit (0),
+        ticks (0) {}
+
+  int repr (int lit) const {
+    int res;
+    while ((res = sweeper->reprs[lit]) != lit)
+      lit = res;
+    return res;
+  }
+
+  void add_literal (int lit) {
+    if (repr (lit) != lit)
+      return;
+    const int idx = abs (lit);
+    if (marked[idx])
+      return;
+    marked[idx] = true;
+    vars.push_back (idx);
+  }
+
+  void add_clause (Clause *c) {
+    if (!swept.insert (c).second)
+      return;
+    assert (clause.empty ());
+    for (const auto &lit : *c) {
+      const signed char tmp = internal->val (lit);
+      if (tmp > 0) {
+        clause.clear ();
+        return;
+      }
+      if (!tmp)
+        clause.push_back (lit);
+    }
+    for (const auto &lit : clause)
+      add_literal (lit);
+    citten_clause_with_id (citten, swept.size (), clause.size (),
+                           clause.data ());
+    if (internal->opts.sweepcountbinary || clause.size () > 2)
+      encoded++;
+    clause.clear ();
+  }
+
+  void environment (int start) {
+    add_literal (start);
+    size_t expand = 0, next = 1;
+    unsigned depth = 1;
+    bool limit_reached = false;
+    while (!limit_reached && encoded < sweeper->limit.clauses) {
+      if (expand == next) {
+        if (depth >= sweeper->limit.depth)
+          break;
+        next = vars.size ();
+        if (expand == next)
+          break;
+        depth++;
+      }
+      const int idx = vars[expand++];
+      for (int sign = 1; !limit_reached && sign >= -1; sign -= 2) {
+        const Occs &os = internal->occs (sign * idx);
+        ticks += 1 + internal->cache_lines (os.size (), sizeof (Clause *));
+        for (const auto &c : os) {
+          ticks++;
+          if (!internal->can_sweep_clause (c))
+            continue;
+          add_clause (c);
+          if (vars.size () >= sweeper->limit.vars) {
+            limit_reached = true;
+            break;
+          }
+        }
+      }
+    }
+  }
+
+  // Returns the status of the sub-solver, which after a satisfiable call
+  // is used to drop the candidates which are not satisfied anymore.
+
+  int solve () {
+    kitten_randomize_phases (citten);
+    const int res = kitten_solve (citten);
+    if (res != 10)
+      return res;
+    auto q = backbone.begin ();
+    for (const auto &lit : backbone)
+      if (kitten_signed_value (citten, lit) > 0)
+        *q++ = lit;
+    backbone.resize (q - backbone.begin ());
+    vector<int> refined;
+    for (auto p = partition.begin (), r = p; p != partition.end ();
+         p = r + 1) {
+      for (int sign = 1; sign >= -1; sign -= 2) {
+        const size_t size = refined.size ();
+        for (r = p; *r; r++)
+          if (kitten_signed_value (citten, *r) == sign)
+            refined.push_back (*r);
+        if (refined.size () - size > 1)
+          refined.push_back (0);
+        else
+          refined.resize (size);
+      }
+    }
+    partition.swap (refined);
+    return res;
+  }
+
+  // Removes the candidate at position 'p' from its class at the end.
+
+  void remove (size_t p) {
+    const size_t size = partition.size ();
+    if (size == 3 || !partition[size - 4])
+      partition.resize (size - 3);
+    else {
+      partition[p] = partition[size - 2];
+      partition[size - 2] = 0;
+      partition.pop_back ();
+    }
+  }
+
+  // Returns 'false' if it is known that neither a backbone literal nor an
+  // equivalence can be found in the environment of 'idx' (or it is not
+  // swept at all).  Hitting the ticks limit is treated as success, since
+  // sweeping might still be successful.
+
+  bool promising (int idx) {
+    if (!internal->active (idx) || repr (idx) != idx)
+      return false;
+    environment (idx);
+    if (vars.size () < 2)
+      return false;
+    kitten_set_ticks_limit (citten, limit);
+    if (solve () != 10)
+      return true;
+    for (const auto &idx : vars)
+      if (internal->active (idx)) {
+        const int lit = kitten_signed_value (citten, idx) < 0 ? -idx : idx;
+        backbone.push_back (lit);
+        partition.push_back (lit);
+      }
+    partition.push_back (0);
+    while (!backbone.empty ()) {
+      const int lit = backbone.back ();
+      backbone.pop_back ();
+      if (kitten_fixed_signed (citten, lit) > 0)
+        return true;
+      if (kitten_status (citten) == 10 &&
+          kitten_flip_signed_literal (citten, lit))
+        continue;
+      kitten_assume_signed (citten, -lit);
+      if (solve () != 10)
+        return true;
+    }
+    while (partition.size () > 2) {
+      const size_t size = partition.size ();
+      const int lit = partition[size - 3], other = partition[size - 2];
+      if (kitten_status (citten) == 10) {
+        if (kitten_flip_signed_literal (citten, lit)) {
+          remove (size - 3);
+          continue;
+        }
+        if (kitten_flip_signed_literal (citten, other)) {
+          remove (size - 2);
+          continue;
+        }
+      }
+      if (abs (lit) > abs (other) && internal->frozen (lit)) {
+        remove (size - 3);
+        continue;
+      }
+      if (abs (other) > abs (lit) && internal->frozen (other)) {
+        remove (size - 2);
+        continue;
+      }
+      kitten_assume_signed (citten, -lit);
+      kitten_assume_signed (citten, other);
+      int res = solve ();
+      if (!res)
+        return true;
+      if (res == 10)
+        continue;
+      kitten_assume_signed (citten, lit);
+      kitten_assume_signed (citten, -other);
+      res = solve ();
+      if (res != 10)
+        return true;
+    }
+    return false;
+  }
+
+  void clear () {
+    ticks += kitten_current_ticks (citten);
+    kitten_clear (citten);
+    for (const auto &idx : vars)
+      marked[idx] = false;
+    vars.clear ();
+    swept.clear ();
+    backbone.clear ();
+    partition.clear ();
+    encoded = 0;
+  }
+
+  void run (const vector<int> *batch, size_t offset, size_t threads) {
+    if (!citten) {
+      citten = kitten_init ();
+      marked.resize (internal->max_var + 1);
+    }
+    for (size_t i = offset; i < batch->size (); i += threads) {
+      const int idx = (*batch)[i];
+      sweeper->promising[idx] = promising (idx) ? 1 : -1;
+      clear ();
+    }
+  }
+
+  void release () {
+    if (citten)
+      kitten_release (citten);
+    citten = 0;
+  }
+};
+
+struct SweepCheckers : public HelperJob {
+
+  vector<SweepWorker> workers; // first one used by the solver thread
+  Helpers helpers;
+
+  const vector<int> *batch; // current batch
+
+  SweepCheckers (Internal *internal, Sweeper *sweeper, size_t threads)
+      : helpers (threads), batch (0) {
+    for (size_t t = 0; t < threads; t++)
+      workers.push_back (SweepWorker (internal, sweeper));
+  }
+
+  ~SweepCheckers () {
+    for (auto &worker : workers)
+      worker.release ();
+  }
+
+  void work (size_t t) { workers[t].run (batch, t, workers.size ()); }
+
+  void check (const vector<int> &b) {
+    batch = &b;
+    helpers.run (*this);
+  }
+};
+
+// Check the next scheduled variables not checked yet in parallel.
+
+static void sweep_batch (Sweeper &sweeper, SweepCheckers *checkers,
+                         vector<int> &batch) {
+  batch.clear ();
+  for (int idx = sweeper.last; idx && batch.size () < sweep_batch_size;
+       idx = sweeper.prev[idx])
+    if (!sweeper.promising[idx])
+      batch.push_back (idx);
+  uint64_t limit = 0;
+  if (sweeper.current_ticks < sweeper.limit.ticks)
+    limit = (sweeper.limit.ticks - sweeper.current_ticks) / batch.size ();
+  for (auto &worker : checkers->workers)
+    worker.limit = limit;
+  checkers->check (batch);
+  uint64_t ticks = 0;
+  for (auto &worker : checkers->workers) {
+    ticks = max (ticks, worker.ticks);
+    worker.ticks = 0;
+  }
+  sweeper.current_ticks += ticks;
+}
+
+#endif
+
+/*------------------------------------------------------------------------*/
+
 bool Internal::sweep () {
   if (!opts.sweep)
     return false;
@@ -1902,6 +2215,13 @@ bool Internal::sweep () {
     sweeper.limit.ticks = tickslimit - stats.ticks.sweep;
   sweep_set_kitten_ticks_limit (sweeper);
   const unsigned scheduled = schedule_sweeping (sweeper);
+#ifndef NTHREADS
+  const size_t threads = opts.sweepthreads;
+  SweepCheckers *checkers = 0;
+  if (threads > 1)
+    checkers = new SweepCheckers (this, &sweeper, threads);
+  vector<int> batch;
+#endif
   uint64_t swept = 0, limit = 10;
   for (;;) {
     if (unsat)
@@ -1910,14 +2230,27 @@ bool Internal::sweep () {
       break;
     if (kitten_ticks_limit_hit (sweeper, "sweeping loop"))
       break;
+#ifndef NTHREADS
+    if (threads > 1 && sweeper.last && !sweeper.promising[sweeper.last])
+      sweep_batch (sweeper, checkers, batch);
+#endif
     int idx = next_scheduled (sweeper);
     if (idx == 0)
       break;
     flags (idx).sweep = false;
-#ifndef QUIET
-    const char *res =
+    const char *res;
+#ifndef NTHREADS
+    const signed char promising = sweeper.promising[idx];
+    sweeper.promising[idx] = 0;
+    if (promising < 0) {
+      stats.sweep_variables++;
+      res = "unsuccessfully in parallel";
+    } else
+#endif
+      res = sweep_variable (sweeper, idx);
+#ifdef QUIET
+    (void) res;
 #endif
-        sweep_variable (sweeper, idx);
     VERBOSE (3, "swept[%" PRIu64 "] external variable %d %s", swept,
              externalize (idx), res);
     if (++swept == limit) {
@@ -1935,6 +2268,9 @@ bool Internal::sweep () {
   PHASE ("sweep", stats.sweep,
          "found %" PRIu64 " equivalences and %" PRIu64 " units",
          equivalences, units);
+#ifndef NTHREADS
+  delete checkers;
+#endif
   unschedule_sweeping (sweeper, swept, scheduled);
   release_sweeper (sweeper);
 
@@ -34,6 +34,7 @@ struct Sweeper {
   vector<unsigned> depths;
   int *reprs;
   vector<int> next, prev;
+  vector<signed char> promising; // checked in parallel (zero if not)
   int first, last, blit;
   unsigned encoded;
   unsigned save;
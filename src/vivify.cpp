@@ -237,20 +237,9 @@ bool Internal::vivify_propagate (int64_t &ticks) {
         if (u > 0)
           j[-1].blit = other;
         else {
-          const int size = w.clause->size;
-          const const_literal_iterator end = lits + size;
-          const literal_iterator middle = lits + w.clause->pos;
-          literal_iterator k = middle;
           signed char v = -1;
           int r = 0;
-          while (k != end && (v = val (r = *k)) < 0)
-            k++;
-          if (v < 0) {
-            k = lits + 2;
-            assert (w.clause->pos <= size);
-            while (k != middle && (v = val (r = *k)) < 0)
-              k++;
-          }
+          literal_iterator k = search_replacement (w.clause, r, v);
           w.clause->pos = k - lits;
           assert (lits + 2 <= k), assert (k <= w.clause->end ());
           if (v > 0)
@@ -1496,6 +1485,247 @@ struct vivify_inversesize_smaller {
   }
 };
 
+/*------------------------------------------------------------------------*/
+#ifndef NTHREADS
+
+// With 'opts.vivifythreads' larger than one candidates are first probed in
+// batches by worker threads.  The workers only have their own assignment
+// and trail and share read-only occurrence lists of all clauses, which are
+// built at the first batch of a round and then frozen.  Thus a literal
+// becoming false visits all clauses containing it, which makes propagation
+// complete without moving watches, and the memory used does not grow with
+// the number of threads.  Most visited clauses are skipped through two
+// other literals stored in the occurrence.  Clauses added by the main
+// thread during the round are ignored, while clauses which became garbage
+// are kept, since they are still implied.  Clauses strengthened in place
+// are used with their remaining literals.  For each candidate the negation
+// of its literals is assumed (and the last literal instantiated) as in
+// 'vivify_clause', but without reusing decisions and on top of the
+// root-level assignment only.  If neither a literal of the candidate is
+// implied nor a conflict occurs, vivification of the candidate fails and
+// it is skipped by the main thread.  All other candidates are vivified as
+// before by the main thread, which thus also commits all strengthened and
+// subsumed clauses.  Building the occurrence lists is counted once in the
+// ticks of the round and the maximum ticks of the workers in a batch are
+// added too, which thus accounts for the elapsed time of probing.  The
+// batch size is fixed and the result for a candidate does not depend on
+// the worker probing it.  Only the ticks of the round and thus where it
+// stops depend on the number of threads.
+
+static const size_t vivify_batch_size = 1u << 6;
+
+// For binary clauses 'blits[0]' is the other literal and 'blits[1]' zero.
+// Otherwise these are two other literals of the clause and the clause can
+// only be unit (or falsified) if one of them is false.
+
+struct VivifyOccurrence {
+  Clause *clause;
+  int blits[2];
+};
+
+struct VivifyWorker {
+
+  Internal *internal;
+  const vector<vector<VivifyOccurrence>> *occs; // shared, indexed by 'vlit'
+  vector<signed char> vals;                      // private assignment
+  vector<int> trail, sorted;
+  size_t propagated;
+  Clause *ignore;
+  int64_t ticks, propagations;
+
+  VivifyWorker (Internal *i, const vector<vector<VivifyOccurrence>> *o)
+      : internal (i), occs (o), vals (2 * (size_t) (i->max_var + 1), 0),
+        propagated (0), ignore (0), ticks (0), propagations (0) {}
+
+  // Root-level values are taken from the solver, which has backtracked.
+
+  signed char val (int lit) const {
+    const signed char tmp = internal->val (lit);
+    if (tmp)
+      return tmp;
+    return vals[internal->vlit (lit)];
+  }
+
+  void assign (int lit) {
+    vals[internal->vlit (lit)] = 1;
+    vals[internal->vlit (-lit)] = -1;
+    trail.push_back (lit);
+  }
+
+  void backtrack (size_t assigned) {
+    while (trail.size () > assigned) {
+      const int lit = trail.back ();
+      trail.pop_back ();
+      vals[internal->vlit (lit)] = vals[internal->vlit (-lit)] = 0;
+    }
+    if (propagated > assigned)
+      propagated = assigned;
+  }
+
+  bool propagate () {
+    bool conflict = false;
+    while (!conflict && propagated < trail.size ()) {
+      const int lit = -trail[propagated++];
+      propagations++;
+      const auto &os = (*occs)[internal->vlit (lit)];
+      ticks +=
+          1 + internal->cache_lines (os.size (), sizeof (VivifyOccurrence));
+      for (const auto &o : os) {
+        const signed char b = val (o.blits[0]);
+        if (b > 0)
+          continue;
+        if (!o.blits[1]) {
+          if (b < 0) {
+            conflict = true;
+            break;
+          }
+          assign (o.blits[0]);
+          continue;
+        }
+        const signed char c = val (o.blits[1]);
+        if (c > 0 || (!b && !c))
+          continue;
+        if (o.clause == ignore)
+          continue;
+        ticks++;
+        int unit = 0;
+        bool open = false;
+        for (const auto &other : *o.clause) {
+          const signed char tmp = val (other);
+          if (tmp < 0)
+            continue;
+          if (tmp > 0 || unit) {
+            open = true;
+            break;
+          }
+          unit = other;
+        }
+        if (open)
+          continue;
+        if (!unit) {
+          conflict = true;
+          break;
+        }
+        assign (unit);
+      }
+    }
+    return !conflict;
+  }
+
+  // Returns 'true' if vivifying the candidate is known to fail.
+
+  bool fails (Clause *c) {
+    ticks++;
+    sorted.clear ();
+    for (const auto &lit : *c) {
+      const signed char tmp = internal->val (lit);
+      if (tmp > 0)
+        return false;
+      if (!tmp)
+        sorted.push_back (lit);
+    }
+    if (sorted.size () <= 2)
+      return false;
+    sort (sorted.begin (), sorted.end (),
+          vivify_more_noccs_kissat (internal));
+    ignore = c;
+    bool res = true;
+    size_t last = 0;
+    for (const auto &lit : sorted) {
+      if (val (lit)) {
+        res = false;
+        break;
+      }
+      last = trail.size ();
+      assign (-lit);
+      if (!propagate ()) {
+        res = false;
+        break;
+      }
+    }
+    if (res && internal->opts.vivifyinst) {
+      backtrack (last);
+      assign (sorted.back ());
+      res = propagate ();
+    }
+    backtrack (0);
+    ignore = 0;
+    return res;
+  }
+};
+
+// The workers, the helper threads and the occurrence lists are kept for
+// the whole round.
+
+struct VivifyProbers : public HelperJob {
+
+  vector<vector<VivifyOccurrence>> occs;
+  vector<VivifyWorker> workers; // first one used by the solver thread
+  Helpers helpers;
+
+  const vector<Clause *> *batch; // current batch
+  vector<signed char> *failed;
+
+  VivifyProbers (Internal *internal, size_t threads)
+      : occs (2 * (size_t) (internal->max_var + 1)), helpers (threads),
+        batch (0), failed (0) {
+    for (const auto &c : internal->clauses) {
+      if (c->garbage)
+        continue;
+      const int *lits = c->literals;
+      for (int i = 0; i < c->size; i++) {
+        VivifyOccurrence o{c, {lits[!i], 0}};
+        if (c->size > 2)
+          o.blits[1] = lits[i < 2 ? 2 : 1];
+        occs[internal->vlit (lits[i])].push_back (o);
+      }
+    }
+    for (size_t t = 0; t < threads; t++)
+      workers.push_back (VivifyWorker (internal, &occs));
+  }
+
+  void work (size_t t) {
+    VivifyWorker &worker = workers[t];
+    for (size_t i = t; i < batch->size (); i += workers.size ())
+      (*failed)[i] = worker.fails ((*batch)[i]);
+  }
+
+  void probe (const vector<Clause *> &b, vector<signed char> &f) {
+    batch = &b, failed = &f;
+    helpers.run (*this);
+  }
+};
+
+// Probe the next candidates at the end of the schedule in parallel.
+
+static void vivify_batch (Internal *internal, Vivifier &vivifier,
+                          VivifyProbers *&probers,
+                          const vector<Clause *> &schedule,
+                          vector<Clause *> &batch,
+                          vector<signed char> &failed) {
+  if (internal->level)
+    internal->backtrack_without_updating_phases ();
+  if (!probers) {
+    probers = new VivifyProbers (internal, internal->opts.vivifythreads);
+    vivifier.ticks += internal->clauses.size ();
+  }
+  batch.clear ();
+  const size_t size = min (schedule.size (), vivify_batch_size);
+  for (size_t i = 0; i < size; i++)
+    batch.push_back (schedule[schedule.size () - 1 - i]);
+  failed.resize (size);
+  probers->probe (batch, failed);
+  int64_t ticks = 0;
+  for (auto &worker : probers->workers) {
+    ticks = max (ticks, worker.ticks);
+    internal->stats.propagations.vivify += worker.propagations;
+    worker.ticks = worker.propagations = 0;
+  }
+  vivifier.ticks += ticks;
+}
+
+#endif
+
 /*------------------------------------------------------------------------*/
 // There are two modes of vivification, one using all clauses and one
 // focusing on irredundant clauses only.  The latter variant working on
@@ -1595,11 +1825,37 @@ void Internal::vivify_round (Vivifier &vivifier, int64_t ticks_limit) {
   }
 
   vivifier.ticks = ticks;
+#ifndef NTHREADS
+  const size_t threads = opts.vivifythreads;
+  VivifyProbers *probers = 0;
+  vector<Clause *> batch;
+  vector<signed char> failed;
+  size_t next = 0;
+#endif
   int retry = 0;
   while (!unsat && !terminated_asynchronously () && !schedule.empty () &&
          vivifier.ticks < limit) {
+#ifndef NTHREADS
+    if (threads > 1 && next == batch.size ()) {
+      vivify_batch (this, vivifier, probers, schedule, batch, failed);
+      next = 0;
+      if (vivifier.ticks >= limit)
+        break;
+    }
+#endif
     Clause *c = schedule.back (); // Next candidate.
     schedule.pop_back ();
+#ifndef NTHREADS
+    if (threads > 1 && next < batch.size () && batch[next] == c &&
+        failed[next++]) {
+      LOG (c, "vivification failed in parallel on");
+      c->vivify = false;
+      c->vivified = true;
+      stats.vivifychecks++;
+      retry = 0;
+      continue;
+    }
+#endif
     if (vivify_clause (vivifier, c) && !c->garbage && c->size > 2 &&
         retry < opts.vivifyretry) {
       ++retry;
@@ -1608,6 +1864,10 @@ void Internal::vivify_round (Vivifier &vivifier, int64_t ticks_limit) {
       retry = 0;
   }
 
+#ifndef NTHREADS
+  delete probers;
+#endif
+
   if (level)
     backtrack_without_updating_phases ();
 
@@ -0,0 +1,305 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+// Local search in 'walk.cpp' stops search while it is running.  With
+// 'opts.walkthread' a snapshot of the irredundant clauses is taken at a
+// restart instead and a helper thread runs 'ProbSAT' style random walks on
+// it while search continues.  Starting from the saved phases the helper
+// flips variables in randomly picked unsatisfied clauses and remembers the
+// assignment with the fewest unsatisfied clauses.  Improved minima are
+// published through a triple buffer and picked up by 'rephase_walk' in
+// 'rephase.cpp' instead of calling 'walk' synchronously.
+
+// The snapshot is over external literals, as in 'background.cpp', since
+// internal variables are renumbered during compaction.  The helper does
+// not access any other solver data and the published assignment only
+// serves as phases, thus nothing has to be justified in proofs.
+
+#ifndef NTHREADS
+
+WalkThread::WalkThread (int m, uint64_t seed)
+    : max_var (m), random (seed), stop (false), finished (false),
+      middle (2), back (1), front (0), flips (0), published (0),
+      minimum (INT64_MAX) {
+  for (auto &u : unsat)
+    u = -1;
+}
+
+// Called by the helper only.  The buffer obtained in exchange for the
+// filled one is not accessed by the solver anymore.
+
+void WalkThread::publish (const std::vector<signed char> &assignment,
+                          int64_t unsatisfied) {
+  values[back] = assignment;
+  unsat[back] = unsatisfied;
+  back = middle.exchange (back | fresh) & ~fresh;
+  published++;
+}
+
+// Called by the solver only.  Returns true if a new assignment was
+// published since the last call, which then is found in 'values[front]'.
+
+bool WalkThread::update () {
+  if (!(middle.load () & fresh))
+    return false;
+  front = middle.exchange (front) & ~fresh;
+  return true;
+}
+
+// Literals are mapped to '2*idx + sign' for the occurrence lists.
+
+static inline unsigned walk_thread_literal (int lit) {
+  return 2u * (unsigned) abs (lit) + (lit < 0);
+}
+
+void WalkThread::run () {
+
+  // Connect clauses through their start in the snapshot.
+
+  std::vector<unsigned> clauses;
+  std::vector<std::vector<unsigned>> occs (2u * (max_var + 1u));
+  for (size_t i = 0, start = 0; i < snapshot.size (); i++) {
+    const int lit = snapshot[i];
+    if (lit) {
+      occs[walk_thread_literal (lit)].push_back (clauses.size ());
+      continue;
+    }
+    clauses.push_back (start);
+    start = i + 1;
+  }
+
+  std::vector<signed char> vals (max_var + 1);
+  for (int idx = 1; idx <= max_var; idx++)
+    vals[idx] = init[idx] < 0 ? -1 : 1;
+  std::vector<signed char>().swap (init);
+
+  // Count satisfied literals and collect the broken (unsatisfied) clauses.
+
+  const unsigned invalid = UINT_MAX;
+  std::vector<unsigned> satisfied (clauses.size ());
+  std::vector<unsigned> broken, pos (clauses.size (), invalid);
+  for (size_t c = 0; c < clauses.size (); c++) {
+    unsigned count = 0;
+    for (const int *p = &snapshot[clauses[c]]; *p; p++) {
+      const int lit = *p;
+      const signed char tmp = vals[abs (lit)];
+      if (lit < 0 ? tmp < 0 : tmp > 0)
+        count++;
+    }
+    satisfied[c] = count;
+    if (!count)
+      pos[c] = broken.size (), broken.push_back (c);
+  }
+
+  // Scores 'base^break' with the default 'CB' value '2.0' from 'walk.cpp'
+  // until they become too small to matter.
+
+  std::vector<double> table;
+  for (double score = 1; score > 1e-20; score *= 0.5)
+    table.push_back (score);
+
+  // The best assignment is only updated lazily on improvement from the
+  // trail of variables flipped since it was updated the last time.
+
+  std::vector<signed char> best = vals;
+  std::vector<int> trail;
+  bool overflow = false;
+  minimum = broken.size ();
+  int64_t last = INT64_MAX;
+
+  std::vector<int> literals;
+  std::vector<double> scores;
+
+  while (!stop) {
+
+    if (minimum < last && (!minimum || flips >= published << 16)) {
+      publish (best, minimum);
+      last = minimum;
+    }
+    if (broken.empty ())
+      break;
+
+    for (unsigned i = 0; !stop && !broken.empty () && i < (1u << 10);
+         i++) {
+
+      // Pick random broken clause and sample literal by break values.
+
+      const unsigned c =
+          broken[random.pick_int (0, (int) broken.size () - 1)];
+      double sum = 0;
+      for (const int *p = &snapshot[clauses[c]]; *p; p++) {
+        const int lit = *p;
+        unsigned breaks = 0;
+        for (const auto &d : occs[walk_thread_literal (-lit)])
+          if (satisfied[d] == 1)
+            breaks++;
+        const double score =
+            breaks < table.size () ? table[breaks] : table.back ();
+        literals.push_back (lit);
+        scores.push_back (score);
+        sum += score;
+      }
+      const double lim = sum * random.generate_double ();
+      size_t j = 0;
+      for (sum = scores[0]; j + 1 < scores.size () && sum < lim;)
+        sum += scores[++j];
+      const int lit = literals[j];
+      literals.clear ();
+      scores.clear ();
+
+      // Flip it and update the broken clauses.
+
+      const int idx = abs (lit);
+      vals[idx] = lit < 0 ? -1 : 1;
+      flips++;
+      for (const auto &d : occs[walk_thread_literal (lit)])
+        if (!satisfied[d]++) {
+          const unsigned moved = broken.back ();
+          pos[moved] = pos[d];
+          broken[pos[d]] = moved;
+          broken.pop_back ();
+          pos[d] = invalid;
+        }
+      for (const auto &d : occs[walk_thread_literal (-lit)])
+        if (!--satisfied[d])
+          pos[d] = broken.size (), broken.push_back (d);
+
+      if (!overflow) {
+        trail.push_back (idx);
+        if (trail.size () > (size_t) max_var / 4)
+          overflow = true;
+      }
+      if ((int64_t) broken.size () >= minimum)
+        continue;
+      minimum = broken.size ();
+      if (overflow)
+        best = vals;
+      else
+        for (const auto &other : trail)
+          best[other] = vals[other];
+      trail.clear ();
+      overflow = false;
+    }
+  }
+  if (minimum < last)
+    publish (best, minimum);
+  finished = true;
+}
+
+struct WalkThreadSnapshot : public ClauseIterator {
+  std::vector<int> &snapshot;
+  WalkThreadSnapshot (std::vector<int> &s) : snapshot (s) {}
+  bool clause (const std::vector<int> &c) {
+    for (const auto &lit : c)
+      snapshot.push_back (lit);
+    snapshot.push_back (0);
+    return true;
+  }
+};
+
+#endif
+
+bool Internal::walkthreading () {
+#ifdef NTHREADS
+  return false;
+#else
+  if (!opts.walkthread || !opts.walk)
+    return false;
+  if (unsat)
+    return false;
+  return stats.conflicts >= lim.walkthread;
+#endif
+}
+
+// The previous helper is stopped and a new one started on a fresh snapshot
+// with the current saved phases as initial assignment.
+
+void Internal::start_walkthread () {
+#ifdef NTHREADS
+  assert (false);
+#else
+  stop_walkthread ();
+  START (walkthread);
+  stats.walkthread.started++;
+  const int max_var = external->max_var;
+  const uint64_t seed = opts.seed + stats.walkthread.started;
+  walkthread = new WalkThread (max_var, seed);
+  vector<signed char> &init = walkthread->init;
+  init.resize (max_var + 1);
+  for (int eidx = 1; eidx <= max_var; eidx++) {
+    const int ilit = external->e2i[eidx];
+    if (!ilit)
+      continue;
+    const int idx = abs (ilit);
+    const signed char tmp = fixed (ilit);
+    if (tmp)
+      init[eidx] = tmp;
+    else if (flags (idx).active ()) {
+      const signed char phase = phases.saved[idx];
+      init[eidx] = ilit < 0 ? -phase : phase;
+    }
+  }
+  WalkThreadSnapshot collector (walkthread->snapshot);
+  traverse_clauses (collector);
+  PHASE ("walkthread", stats.walkthread.started,
+         "local search on snapshot of %zu literals in helper thread",
+         walkthread->snapshot.size ());
+  walkthread->thread = std::thread (&WalkThread::run, walkthread);
+  lim.walkthread =
+      stats.conflicts + opts.walkthreadint * stats.walkthread.started;
+  STOP (walkthread);
+#endif
+}
+
+// Overwrite the saved phases of active variables by the latest assignment
+// published by the helper.  Returns false if nothing new was published
+// since the last import, and then 'walk' is run instead.
+
+bool Internal::import_walkthread () {
+#ifdef NTHREADS
+  return false;
+#else
+  if (!walkthread)
+    return false;
+  if (!walkthread->update ())
+    return false;
+  const vector<signed char> &values = walkthread->values[walkthread->front];
+  const int64_t unsatisfied = walkthread->unsat[walkthread->front];
+  stats.walkthread.imported++;
+  PHASE ("walkthread", stats.walkthread.imported,
+         "importing phases with %" PRId64 " unsatisfied clauses",
+         unsatisfied);
+  for (auto idx : vars) {
+    if (!flags (idx).active ())
+      continue;
+    const int elit = externalize (idx);
+    const int eidx = abs (elit);
+    if ((size_t) eidx >= values.size () || !values[eidx])
+      continue;
+    const signed char value = values[eidx];
+    phases.saved[idx] = elit < 0 ? -value : value;
+  }
+  copy_phases (phases.prev);
+  return true;
+#endif
+}
+
+// Ask the helper to stop, join it and delete it.
+
+void Internal::stop_walkthread () {
+#ifndef NTHREADS
+  if (!walkthread)
+    return;
+  walkthread->stop = true;
+  walkthread->thread.join ();
+  stats.walkthread.flips += walkthread->flips;
+  PHASE ("walkthread", stats.walkthread.started,
+         "helper flipped %" PRId64 " variables reaching minimum %" PRId64,
+         walkthread->flips, walkthread->minimum);
+  delete walkthread;
+  walkthread = 0;
+#endif
+}
+
+} // namespace CaDiCaL
@@ -0,0 +1,59 @@
+#ifndef _walkthread_hpp_INCLUDED
+#define _walkthread_hpp_INCLUDED
+
+#ifndef NTHREADS
+
+#include "random.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace CaDiCaL {
+
+// Local search on a snapshot of the irredundant clauses in a helper thread
+// running concurrently to search (see 'walkthread.cpp').  The helper only
+// accesses the snapshot and publishes the best assignment it found so far
+// through a lock-free triple buffer, from which 'rephase' picks it up.
+
+struct WalkThread {
+
+  int max_var;                   // maximum external variable
+  std::vector<int> snapshot;     // zero terminated clauses
+  std::vector<signed char> init; // initial assignment by variable
+  Random random;
+
+  std::atomic<bool> stop;     // asked to stop by solver
+  std::atomic<bool> finished; // helper done
+  std::thread thread;
+
+  // Three assignments indexed by external variable with their number of
+  // unsatisfied clauses.  The helper fills 'back' and exchanges it with
+  // 'middle' marked as 'fresh', while the solver exchanges 'front' with
+  // 'middle' if it is fresh.  Thus no assignment is read and written
+  // concurrently and neither of the two threads ever waits.
+  //
+  static const unsigned fresh = 4;
+  std::vector<signed char> values[3];
+  int64_t unsat[3];
+  std::atomic<unsigned> middle;
+  unsigned back;  // helper only
+  unsigned front; // solver only
+
+  // Written by the helper thread and only read after joining it.
+  //
+  int64_t flips, published, minimum;
+
+  WalkThread (int max_var, uint64_t seed);
+
+  void publish (const std::vector<signed char> &, int64_t unsat);
+  bool update ();
+  void run ();
+};
+
+} // namespace CaDiCaL
+
+#endif
+
+#endif
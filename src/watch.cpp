@@ -29,6 +29,32 @@ void Internal::connect_watches (bool irredundant_only) {
 
   LOG ("watching all %sclauses", irredundant_only ? "irredundant " : "");
 
+  // Watch lists are usually empty here (after 'reset_watches' or
+  // 'clear_watches').  Growing them one watch at a time would reallocate
+  // and copy every watch list logarithmically often and further fragment
+  // memory, which is noticeable for instances with millions of variables.
+  // Thus we first count the number of watches of each literal and then
+  // reserve exactly that amount of memory once for each watch list.
+  //
+  {
+    vector<unsigned> count (2 * vsize);
+    for (const auto &c : clauses) {
+      if (irredundant_only && c->redundant)
+        continue;
+      if (c->garbage)
+        continue;
+      count[vlit (c->literals[0])]++;
+      count[vlit (c->literals[1])]++;
+    }
+    for (auto lit : lits) {
+      const unsigned added = count[vlit (lit)];
+      if (!added)
+        continue;
+      Watches &ws = watches (lit);
+      ws.reserve (ws.size () + added);
+    }
+  }
+
   // First connect binary clauses.
   //
   for (const auto &c : clauses) {
@@ -4,6 +4,10 @@
 #include <cassert>
 #include <vector>
 
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
 #include "clause.hpp"
 
 namespace CaDiCaL {
@@ -17,6 +21,20 @@ namespace CaDiCaL {
 // to use at least one more bit (either taken away from the variable space
 // or the clauses) to denote whether the watch is binary.
 
+// Using offsets into the 'Arena' as such 32-bit references (as in MiniSAT
+// or Kissat) would give 8 byte watches, but does not work here, since
+// only clauses surviving a moving garbage collection (and only after the
+// second one, see 'arenaing') are placed in the arena.  All new learned
+// clauses, resolvents and strengthened clauses are allocated individually
+// in 'new_clause' and live outside of the arena until the next collection.
+// They can not be referenced by an offset without putting every clause
+// into the arena and thus making the arena grow on demand, which in turn
+// would invalidate the 'Clause' pointers kept in reasons, occurrence lists
+// and schedules all over the solver.  Since watches are copied by value in
+// 'propagate' we rather keep the pointer and instead make sure that
+// clauses watched by the same literal are close to each other in the
+// arena (see 'opts.arenatype' and 'copy_non_garbage_clauses').
+
 // in fashion of Intel Sat 10.4230/LIPIcs.SAT.2022.8 we try to
 // guarantee the following invariant:
 // For both watches:
@@ -60,6 +78,66 @@ inline void remove_watch (Watches &ws, Clause *clause) {
   ws.resize (i - ws.begin ());
 }
 
+// Move the binary watch just pushed at the end of the watch list in front
+// of all the long watches at the end of that list.  If binary watches are
+// kept in front of long watches the binary propagation pass in 'propagate'
+// can stop at the first long watch (see 'opts.binaryfirst').  This is
+// linear in the number of long watches, thus only called with that option.
+
+inline void move_last_binary_watch_forward (Watches &ws) {
+  assert (!ws.empty ());
+  assert (ws.back ().binary ());
+  const auto last = ws.end () - 1;
+  auto first_long = last;
+  while (first_long != ws.begin () && !first_long[-1].binary ())
+    first_long--;
+  if (first_long != last)
+    std::swap (*first_long, *last);
+}
+
+// Find the first literal in '[k,end)' which is not assigned to false with
+// respect to the literal indexed values 'vals' and return 'end' if all are
+// falsified.  This is the inner loop of the search for a replacement watch
+// in 'propagate' and its variants in probing, vivification and
+// instantiation.  For long clauses (learned clauses in stable mode often
+// have hundreds of literals) the values of eight literals are gathered and
+// compared at once if the compiler targets AVX2 (e.g., '-march=native').
+// The gather reads four bytes starting at 'vals[lit]', which is why 'vals'
+// is allocated with some padding at the end (see 'enlarge_vals').
+
+inline literal_iterator find_non_false_literal (const signed char *vals,
+                                                literal_iterator k,
+                                                const_literal_iterator end) {
+#ifdef __AVX2__
+  while (end - k >= 8) {
+    const __m256i lits = _mm256_loadu_si256 ((const __m256i *) k);
+    const __m256i words =
+        _mm256_i32gather_epi32 ((const int *) vals, lits, 1);
+    const __m256i signs = _mm256_slli_epi32 (words, 24);
+    const unsigned falsified =
+        (unsigned) _mm256_movemask_ps (_mm256_castsi256_ps (signs));
+    if (falsified != 0xffu)
+      return k + __builtin_ctz (~falsified);
+    k += 8;
+  }
+#endif
+  while (k != end && vals[*k] < 0)
+    k++;
+  return k;
+}
+
+// Garbage collection flushes watch lists and previously shrunk each list
+// to its exact size, which then is immediately enlarged again (doubling
+// its capacity) as soon one new watch is added during search.  This
+// repeated freeing and allocating of all watch lists at every collection
+// fragments memory.  We only give back memory if at least half of the
+// capacity of a watch list is unused.
+
+inline void shrink_watches (Watches &ws) {
+  if (ws.capacity () > 2 * ws.size ())
+    shrink_vector (ws);
+}
+
 // search for the clause and updates the size marked in the watch lists
 inline void update_watch_size (Watches &ws, int blit, Clause *conflict) {
   bool found = false;
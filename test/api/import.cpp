@@ -0,0 +1,136 @@
+#include "../../src/cadical.hpp"
+
+#include <iostream>
+#include <thread>
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+extern "C" {
+#include <assert.h>
+}
+
+// Pigeon hole formula with 'holes + 1' pigeons, which needs enough
+// conflicts to restart and thus to import clauses.
+
+static const int holes = 6;
+
+static int pigeon (int p, int h) { return p * holes + h + 1; }
+
+static void formula (CaDiCaL::Solver &solver) {
+  for (int p = 0; p <= holes; p++) {
+    for (int h = 0; h < holes; h++)
+      solver.add (pigeon (p, h));
+    solver.add (0);
+  }
+  for (int h = 0; h < holes; h++)
+    for (int p = 0; p <= holes; p++)
+      for (int q = p + 1; q <= holes; q++)
+        solver.add (-pigeon (p, h)), solver.add (-pigeon (q, h)),
+            solver.add (0);
+}
+
+class Exporter : public CaDiCaL::Learner {
+  CaDiCaL::Solver *solver;
+  std::vector<int> clause;
+
+public:
+  std::vector<std::vector<int>> clauses;
+  Exporter (CaDiCaL::Solver *s) : solver (s) {
+    solver->connect_learner (this);
+  }
+  ~Exporter () { solver->disconnect_learner (); }
+  bool learning (int size) { return size <= 8; }
+  void learn (int lit) {
+    if (lit)
+      clause.push_back (lit);
+    else
+      clauses.push_back (clause), clause.clear ();
+  }
+};
+
+class Provider : public CaDiCaL::Importer {
+  CaDiCaL::Solver *solver;
+  const std::vector<std::vector<int>> &clauses;
+  size_t literal;
+
+public:
+  size_t imported;
+  Provider (CaDiCaL::Solver *s, const std::vector<std::vector<int>> &c)
+      : solver (s), clauses (c), literal (0), imported (0) {
+    solver->connect_importer (this);
+  }
+  ~Provider () { solver->disconnect_importer (); }
+  bool importing () { return imported < clauses.size (); }
+  int import () {
+    const std::vector<int> &clause = clauses[imported];
+    if (literal < clause.size ())
+      return clause[literal++];
+    literal = 0;
+    imported++;
+    return 0;
+  }
+};
+
+int main () {
+
+  // Collect the clauses learned by a first solver.
+
+  CaDiCaL::Solver ping;
+  formula (ping);
+  std::vector<std::vector<int>> clauses;
+  {
+    Exporter exporter (&ping);
+    int res = ping.solve ();
+    std::cout << "ping returns " << res << std::endl;
+    assert (res == 20);
+    clauses = exporter.clauses;
+  }
+  std::cout << "ping exported " << clauses.size () << " clauses"
+            << std::endl;
+  assert (!clauses.empty ());
+
+  // Import them through a connected importer.  Imported units are not
+  // exported again.
+
+  CaDiCaL::Solver pong;
+  formula (pong);
+  {
+    Provider provider (&pong, clauses);
+    Exporter exporter (&pong);
+    int res = pong.solve ();
+    std::cout << "pong returns " << res << " after importing "
+              << provider.imported << " clauses" << std::endl;
+    assert (res == 20);
+    assert (provider.imported > 0);
+    for (const auto &clause : exporter.clauses)
+      if (clause.size () == 1)
+        for (size_t i = 0; i < provider.imported; i++)
+          assert (clauses[i] != clause);
+  }
+  assert (pong.get_statistic_value ("imported") > 0);
+
+  // Import them through the thread-safe 'import_clause' from the main
+  // thread while a third solver is solving in another thread.  Half of
+  // the clauses are pushed before solving starts to make sure that some
+  // clauses are imported even if solving is fast.
+
+  CaDiCaL::Solver pang;
+  formula (pang);
+  const size_t half = clauses.size () / 2;
+  for (size_t i = 0; i < half; i++)
+    pang.import_clause (clauses[i]);
+  int res = 0;
+  std::thread solving ([&] { res = pang.solve (); });
+  for (size_t i = half; i < clauses.size (); i++)
+    pang.import_clause (clauses[i]);
+  solving.join ();
+  const int64_t imported = pang.get_statistic_value ("imported");
+  std::cout << "pang returns " << res << " after importing " << imported
+            << " clauses" << std::endl;
+  assert (res == 20);
+  assert (imported > 0);
+
+  return 0;
+}
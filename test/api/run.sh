@@ -80,6 +80,7 @@ run () {
     language=""
     COMPILE="$CXX $CXXFLAGS"
     [ x"$1" = xparcompwrite ] && COMPILE="$COMPILE -pthread"
+    [ x"$1" = ximport ] && COMPILE="$COMPILE -pthread"
   else
     die "can not find '$tests.c' nor '$tests.cpp'"
   fi
@@ -113,6 +114,7 @@ run example_constraint
 run example_tracer
 run terminate
 run learn
+run import
 run cfreeze
 run traverse
 run cipasir
@@ -105,10 +105,11 @@ core () {
   msg "running CNF test core ${HILITE}'$1'${NORMAL}"
   prefix=$CADICALBUILD/test-cnf-core
   cnf=../test/cnf/$1.cnf
-  log=$prefix-$1.log
-  err=$prefix-$1.err
-  chk=$prefix-$1.chk
-  prf=$prefix-$1.prf
+  name=$1`echo "$4"|sed -e 's,--*,-,g' -e 's,=,,g'`
+  log=$prefix-$name.log
+  err=$prefix-$name.err
+  chk=$prefix-$name.chk
+  prf=$prefix-$name.prf
   proofchecker=$3
   if [ -f cnf/$1.sol ]
   then
@@ -122,6 +123,7 @@ core () {
     *) proofopts="";;
   esac
   opts="$cnf --check$solopts$proofopts"
+  [ x"$4" = x ] || opts="$opts $4"
   cecho "$coresolver \\"
   cecho "$opts"
   cecho -n "# $2 ..."
@@ -323,6 +325,19 @@ run add128 20
 
 run prime65537 20
 
+# Trail saving with and without checking LRAT proofs.
+
+trailsave () {
+  core $1 $2 none --trailsave
+  core $1 $2 $lratchecker --trailsave
+}
+
+trailsave sqrt63001 10
+trailsave ph6 20
+trailsave add64 20
+trailsave add128 20
+trailsave prime65537 20
+
 #--------------------------------------------------------------------------#
 
 [ $ok -gt 0 ] && OK="$GOOD"
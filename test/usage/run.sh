@@ -118,6 +118,54 @@ do
   run 20 $option ../test/cnf/add16.cnf
 done
 
+for option in --scoreheap=2 --scoreheap=3
+do
+  run 20 $option --stabilizeonly ../test/cnf/add64.cnf
+  run 10 $option --stabilizeonly ../test/cnf/prime2209.cnf
+done
+
+# Frequent reductions to exercise selecting reduce candidates.
+
+run 20 --reduceinit=10 --reduceint=2 ../test/cnf/prime65537.cnf
+run 10 --reduceinit=10 --reduceint=2 ../test/cnf/prime2209.cnf
+
+run 20 --slab=1 ../test/cnf/add16.cnf
+run 10 --slab=1 ../test/cnf/prime2209.cnf
+
+if [ x"`$solver --build 2>/dev/null|grep NTHREADS`" = x ]
+then
+  for option in "-j 2" "-j 4"
+  do
+    run 20 $option ../test/cnf/add16.cnf
+    run 10 $option ../test/cnf/prime2209.cnf
+  done
+  run 1 -j 2 ../test/cnf/add16.cnf -
+  for option in "-C 2" "-C 3 -j 3"
+  do
+    run 20 $option ../test/cnf/add16.cnf
+    run 10 $option ../test/cnf/prime2209.cnf
+  done
+  run 1 -C 2 -c 10 ../test/cnf/add16.cnf
+  run 1 -C 2 -d 10 ../test/cnf/add16.cnf
+  run 1 -C 2 --deterministic ../test/cnf/add16.cnf
+  run 1 -C 2 -P1 ../test/cnf/add16.cnf
+  run 1 -C 2 -L1 ../test/cnf/add16.cnf
+  run 20 -j 4 --deterministic ../test/cnf/add16.cnf
+  run 10 -j 4 --deterministic ../test/cnf/prime2209.cnf
+  run 20 --background ../test/cnf/add16.cnf
+  run 10 --background ../test/cnf/prime2209.cnf
+  run 20 --subsumethreads=4 ../test/cnf/add16.cnf
+  run 10 --subsumethreads=4 ../test/cnf/prime2209.cnf
+  run 20 --elimthreads=4 ../test/cnf/add16.cnf
+  run 10 --elimthreads=4 ../test/cnf/prime2209.cnf
+  run 20 --vivifythreads=4 ../test/cnf/add16.cnf
+  run 10 --vivifythreads=4 ../test/cnf/prime2209.cnf
+  run 20 --sweepthreads=4 ../test/cnf/add16.cnf
+  run 10 --sweepthreads=4 ../test/cnf/prime2209.cnf
+  run 20 --walkthread ../test/cnf/add16.cnf
+  run 10 --walkthread ../test/cnf/prime2209.cnf
+fi
+
 # run 0 -t
 # run 0 -O
 # run 0 -c 0